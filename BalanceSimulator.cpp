@@ -0,0 +1,301 @@
+#include "BalanceSimulator.h"
+#include "Enemy.h"
+#include "ItemFactory.h"
+#include "Player.h"
+#include "Utility.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+/**
+ * @file BalanceSimulator.cpp
+ * @brief Implements the batch Monte Carlo fight simulator.
+ *
+ * Responsibilities:
+ *  - Reduce each side of a matchup to the few numbers a fight needs.
+ *  - Advance LANES fights per round with vectorisable loops.
+ *  - Share matchups out to worker threads and print the results.
+ */
+
+/**
+ * @brief One side of a matchup, reduced to what the fight loop needs.
+ *
+ * Rolls pass when 24 random bits are below the threshold, so a chance of p
+ * becomes a threshold of p * 2^24 (2^24 for a certain success).
+ */
+struct Fighter {
+    std::uint32_t attackThreshold;  ///< Attack roll threshold.
+    std::uint32_t defenceThreshold; ///< Defence roll threshold.
+    std::int32_t health;            ///< Starting health.
+    std::int32_t hitDamage;         ///< Damage a hit of this side deals to the other.
+    std::int32_t reactionDamage;    ///< Damage this side takes after defending (COUNTER).
+    std::int32_t reactionHeal;      ///< Health this side regains after defending (HEAL).
+    std::int32_t randomReaction;    ///< 1 for RANDOM_DAMAGE: also takes 0 to MAX_RANDOM_DEFENCE_DAMAGE after defending.
+};
+
+/**
+ * @brief Converts a probability into a 24-bit roll threshold.
+ * @param chance Probability in [0, 1].
+ * @return Threshold in [0, 2^24].
+ */
+static std::uint32_t rollThreshold(double chance)
+{
+    constexpr double ONE = 1 << 24;
+    return static_cast<std::uint32_t>(std::clamp(chance, 0.0, 1.0) * ONE);
+}
+
+/**
+ * @brief Converts a combat profile into a Fighter.
+ * @param self Profile of the side (Character::combatProfile).
+ * @return The fighter.
+ */
+static Fighter makeFighter(const Character::CombatProfile &self)
+{
+    Fighter f{};
+    f.attackThreshold = rollThreshold(self.attackChance);
+    f.defenceThreshold = rollThreshold(self.defenceChance);
+    f.health = self.health;
+    f.hitDamage = self.hitDamage;
+    f.reactionDamage = self.counterDamage;
+    f.reactionHeal = self.reaction == Constants::DefenceReaction::HEAL ? 1 : 0;
+    f.randomReaction = self.reaction == Constants::DefenceReaction::RANDOM_DAMAGE ? 1 : 0;
+    return f;
+}
+
+/**
+ * @brief Advances one xorshift32 stream and returns its top 24 bits.
+ * @param s Stream state (never 0).
+ */
+static inline std::uint32_t nextRoll(std::uint32_t &s)
+{
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s >> 8;
+}
+
+/**
+ * @brief State of LANES fights in structure-of-arrays form.
+ *
+ * Kept in one struct so the compiler can see that the arrays never overlap
+ * and vectorise the per-lane loops without runtime alias checks.
+ */
+struct Lanes {
+    alignas(64) std::int32_t health[2][BalanceSimulator::LANES]; ///< [PLAYER] and [ENEMY] health per lane.
+    alignas(64) std::uint32_t rng[BalanceSimulator::LANES];      ///< xorshift32 state per lane.
+    alignas(64) std::int32_t rounds[BalanceSimulator::LANES];    ///< Rounds fought so far per lane.
+};
+
+/// Number of values a RANDOM_DAMAGE reaction can take (0 to the maximum).
+constexpr std::uint32_t RANDOM_DAMAGE_VALUES = Character::MAX_RANDOM_DEFENCE_DAMAGE + 1;
+
+/// Rounds simulated between checks for finished fights.
+constexpr int REFILL_INTERVAL = 8;
+static_assert(BalanceSimulator::MAX_ROUNDS % REFILL_INTERVAL == 0, "draws are detected exactly at MAX_ROUNDS");
+
+/// Index of the player's and the enemy's health array in Lanes::health.
+enum Side : int { PLAYER = 0, ENEMY = 1 };
+
+/**
+ * @brief One attack by side A in every lane where both sides are still alive.
+ *
+ * Branch-free per lane, so the loop vectorises. Mirrors
+ * Character::resolveAttack: roll attack, roll defence, then either the
+ * defender's reaction or attack - defence damage.
+ *
+ * @tparam A Attacking side; the other side defends.
+ * @param a Attacking side's fighter.
+ * @param d Defending side's fighter.
+ * @param lanes Fights to advance.
+ */
+template <int A>
+static void strike(const Fighter &a, const Fighter &d, Lanes &lanes)
+{
+    const std::int32_t *attackerHealth = lanes.health[A];
+    std::int32_t *defenderHealth = lanes.health[1 - A];
+    std::int32_t *rounds = lanes.rounds;
+    for (int i = 0; i < BalanceSimulator::LANES; ++i) {
+        std::uint32_t s = lanes.rng[i];
+        const std::uint32_t attackRoll = nextRoll(s);
+        const std::uint32_t defenceRoll = nextRoll(s);
+        const std::uint32_t damageRoll = nextRoll(s);
+        lanes.rng[i] = s;
+
+        const std::int32_t health = defenderHealth[i];
+        // 0/1 as 32-bit ints rather than bools, so every lane value has the same width
+        const std::int32_t live = (attackerHealth[i] > 0) & (health > 0);
+        if constexpr (A == PLAYER) rounds[i] += live; // a round starts with the player's attack
+        const std::int32_t hit = live & (attackRoll < a.attackThreshold);
+        const std::int32_t defended = hit & (defenceRoll < d.defenceThreshold);
+        const std::int32_t reaction = d.reactionDamage
+                                      + d.randomReaction * static_cast<std::int32_t>((damageRoll * RANDOM_DAMAGE_VALUES) >> 24);
+        const std::int32_t damage = defended * reaction + (hit - defended) * a.hitDamage;
+        defenderHealth[i] = std::max(health - damage, 0) + defended * d.reactionHeal;
+    }
+}
+
+/**
+ * @brief Half-width of the 95% interval: 1.96 * sqrt(p (1 - p) / n).
+ * @return The half-width, as a fraction.
+ */
+double BalanceSimulator::Result::confidence95() const
+{
+    if (fights == 0) return 0.0;
+    const double p = winRate();
+    return 1.96 * std::sqrt(p * (1.0 - p) / static_cast<double>(fights));
+}
+
+/**
+ * @brief Simulates fights of one matchup, LANES at a time.
+ *
+ * PSEUDOCODE:
+ *  build Fighter player/enemy from real Player/Enemy objects
+ *  seed one xorshift stream per lane; every lane starts idle (both health 0)
+ *  repeat:
+ *      for each lane whose fight is over (someone dead, or MAX_ROUNDS reached):
+ *          tally it (unless the lane was idle)
+ *          start the next fight in the lane, or leave it idle if none are left
+ *      stop if no lane has a fight
+ *      REFILL_INTERVAL times: strike(player → enemy); strike(enemy → player)
+ *
+ * Refilling lanes as fights end keeps them busy instead of waiting for the
+ * longest fight of a batch.
+ */
+BalanceSimulator::Result BalanceSimulator::simulate(const Matchup &matchup, std::uint64_t fights,
+                                                    std::uint64_t seed)
+{
+    Player player(matchup.player, 0, 0);
+    Enemy enemy(static_cast<int>(matchup.enemy));
+    if (matchup.itemKind >= 0) player.pickUp(ItemFactory::item(matchup.itemKind));
+    player.updateForTime(matchup.night);
+    enemy.updateForTime(matchup.night);
+    const Fighter p = makeFighter(player.combatProfile(enemy, matchup.night));
+    const Fighter e = makeFighter(enemy.combatProfile(player, matchup.night));
+
+    Result result;
+    Lanes lanes;
+    std::int32_t *playerHealth = lanes.health[PLAYER];
+    std::int32_t *enemyHealth = lanes.health[ENEMY];
+    std::mt19937 gen(Utility::deriveSeed(seed, 0, 0));
+    for (int i = 0; i < LANES; ++i) {
+        lanes.rng[i] = static_cast<std::uint32_t>(gen()) | 1u;
+        playerHealth[i] = enemyHealth[i] = lanes.rounds[i] = 0;
+    }
+
+    std::uint64_t started = 0;
+    for (;;) {
+        int busy = 0;
+        for (int i = 0; i < LANES; ++i) {
+            const bool decided = playerHealth[i] <= 0 || enemyHealth[i] <= 0;
+            if (!decided && lanes.rounds[i] < MAX_ROUNDS) {
+                ++busy;
+                continue;
+            }
+            if (playerHealth[i] > 0 || enemyHealth[i] > 0) { // a fight just ended (idle lanes are both 0)
+                if (enemyHealth[i] <= 0) ++result.wins;
+                else if (playerHealth[i] <= 0) ++result.losses;
+                else ++result.draws;
+                result.rounds += static_cast<std::uint64_t>(lanes.rounds[i]);
+                ++result.fights;
+            }
+            const bool next = started < fights;
+            started += next;
+            busy += next;
+            playerHealth[i] = next ? p.health : 0;
+            enemyHealth[i] = next ? e.health : 0;
+            lanes.rounds[i] = 0;
+        }
+        if (busy == 0) break;
+        for (int round = 0; round < REFILL_INTERVAL; ++round) {
+            strike<PLAYER>(p, e, lanes);
+            strike<ENEMY>(e, p, lanes);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Simulates every matchup on a pool of worker threads.
+ */
+std::vector<BalanceSimulator::Result> BalanceSimulator::simulateAll(std::uint64_t fights, std::uint64_t seed,
+                                                                    unsigned threadCount)
+{
+    const int count = matchupCount();
+    std::vector<Result> results(static_cast<size_t>(count));
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, static_cast<unsigned>(count));
+
+    std::atomic<int> next{0};
+    auto worker = [&]() {
+        for (int i = next++; i < count; i = next++) {
+            results[static_cast<size_t>(i)] = simulate(matchupAt(i), fights,
+                                                       Utility::deriveSeed(seed, static_cast<std::uint64_t>(i), 1));
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+    for (unsigned t = 1; t < threadCount; ++t) workers.emplace_back(worker);
+    worker();
+    for (auto &w : workers) w.join();
+    return results;
+}
+
+/**
+ * @brief Two times of day, times no item plus each catalogue item, times every race pair.
+ */
+int BalanceSimulator::matchupCount()
+{
+    return 2 * (ItemFactory::ITEM_KIND_COUNT + 1) * Constants::RACE_COUNT * Constants::RACE_COUNT;
+}
+
+/**
+ * @brief Decodes a simulateAll() index (see header for the order).
+ */
+BalanceSimulator::Matchup BalanceSimulator::matchupAt(int index)
+{
+    Matchup m;
+    m.enemy = static_cast<Constants::Race>(index % Constants::RACE_COUNT);
+    index /= Constants::RACE_COUNT;
+    m.player = static_cast<Constants::Race>(index % Constants::RACE_COUNT);
+    index /= Constants::RACE_COUNT;
+    m.itemKind = index % (ItemFactory::ITEM_KIND_COUNT + 1) - 1;
+    m.night = index / (ItemFactory::ITEM_KIND_COUNT + 1) != 0;
+    return m;
+}
+
+/**
+ * @brief Prints one RACE_COUNT x RACE_COUNT table per time of day and item.
+ *
+ * Rows are player races, columns enemy races; a cell reads "52.3+/-0.3", the
+ * player's win rate and its 95% interval in percent.
+ */
+void BalanceSimulator::printMatrix(std::ostream &out, const std::vector<Result> &results)
+{
+    constexpr int CELL = 12;
+    const int tableSize = Constants::RACE_COUNT * Constants::RACE_COUNT;
+    for (int table = 0; table * tableSize < static_cast<int>(results.size()); ++table) {
+        const Matchup first = matchupAt(table * tableSize);
+        out << "\n" << (first.night ? "Night" : "Day") << ", "
+            << (first.itemKind < 0 ? std::string_view("no item") : ItemFactory::nameOf(first.itemKind))
+            << " (player win %, rows: player, columns: enemy)\n";
+        out << std::setw(CELL) << "";
+        for (int e = 0; e < Constants::RACE_COUNT; ++e) out << std::setw(CELL) << Constants::RACE_NAMES[e];
+        out << "\n";
+        for (int p = 0; p < Constants::RACE_COUNT; ++p) {
+            out << std::setw(CELL) << Constants::RACE_NAMES[p];
+            for (int e = 0; e < Constants::RACE_COUNT; ++e) {
+                const Result &r = results[static_cast<size_t>(table * tableSize + p * Constants::RACE_COUNT + e)];
+                std::ostringstream cell;
+                cell << std::fixed << std::setprecision(1) << 100.0 * r.winRate()
+                     << "+/-" << 100.0 * r.confidence95();
+                out << std::setw(CELL) << cell.str();
+            }
+            out << "\n";
+        }
+    }
+}
@@ -0,0 +1,127 @@
+/**
+ * @file BalanceSimulator.h
+ * @brief Declares BalanceSimulator, a batch Monte Carlo engine for race matchup win rates.
+ *
+ * A fight is what repeated Board::playerAttack calls amount to: each round
+ * the player attacks the enemy and, if the enemy survives, the enemy strikes
+ * back, until one of them dies. Every attack follows Character::resolveAttack
+ * (attack roll, defence roll, the defender's DefenceReaction on a successful
+ * defence, attack - defence damage on a hit).
+ *
+ * LANES independent fights are held in structure-of-arrays form (one array
+ * per health bar, round counter and random stream) and advanced one round at
+ * a time with branch-free loops the compiler turns into SIMD code; a lane
+ * whose fight has ended is tallied and given the next fight. Attack and
+ * defence rolls are Bernoulli samples taken by comparing 24 random bits
+ * against a precomputed threshold.
+ */
+
+#ifndef BALANCESIMULATOR_H
+#define BALANCESIMULATOR_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+#include "Constants.h"
+
+/**
+ * @class BalanceSimulator
+ * @brief Static Monte Carlo simulator of player-versus-enemy fights.
+ *
+ * Design:
+ *  - All functions are static.
+ *  - No instances are allowed (constructor is deleted).
+ */
+class BalanceSimulator {
+public:
+    /// Number of fights advanced together.
+    static constexpr int LANES = 256;
+
+    /// Rounds after which an undecided fight (e.g. neither side can do damage) is a draw.
+    static constexpr int MAX_ROUNDS = Constants::MAX_FIGHT_ROUNDS;
+
+    /**
+     * @struct Matchup
+     * @brief Who fights whom, and when.
+     */
+    struct Matchup {
+        Constants::Race player = Constants::Race::HUMAN; ///< Player race.
+        Constants::Race enemy = Constants::Race::HUMAN;  ///< Enemy race.
+        bool night = false;                              ///< Fought at night.
+        int itemKind = -1;                               ///< Catalogue item the player carries, or -1 for none.
+    };
+
+    /**
+     * @struct Result
+     * @brief Tally of the fights of one matchup.
+     */
+    struct Result {
+        std::uint64_t fights = 0; ///< Fights simulated.
+        std::uint64_t wins = 0;   ///< Fights the player won.
+        std::uint64_t losses = 0; ///< Fights the player lost.
+        std::uint64_t draws = 0;  ///< Fights still undecided after MAX_ROUNDS.
+        std::uint64_t rounds = 0; ///< Rounds fought, summed over all fights.
+
+        /// @return Fraction of fights won.
+        double winRate() const { return fights ? static_cast<double>(wins) / fights : 0.0; }
+
+        /// @return Half-width of the 95% confidence interval of winRate() (normal approximation).
+        double confidence95() const;
+    };
+
+    /**
+     * @brief Simulates fights of one matchup.
+     *
+     * Each lane draws from its own stream, all seeded from
+     * Utility::deriveSeed(seed, 0, 0), so the result depends only on the
+     * arguments.
+     *
+     * @param matchup Matchup to simulate.
+     * @param fights Number of fights.
+     * @param seed Seed of the random streams.
+     * @return The tally.
+     */
+    static Result simulate(const Matchup &matchup, std::uint64_t fights, std::uint64_t seed);
+
+    /**
+     * @brief Simulates every matchup: all player and enemy races, day and night,
+     *        with no item and with each catalogue item.
+     *
+     * Matchups are shared out to worker threads through an atomic counter;
+     * matchup i is simulated with seed Utility::deriveSeed(seed, i, 1), so the
+     * results do not depend on the thread count.
+     *
+     * @param fights Fights per matchup.
+     * @param seed Seed of the whole run.
+     * @param threadCount Number of worker threads; 0 uses std::thread::hardware_concurrency().
+     * @return One result per matchup, in matchupAt() order.
+     */
+    static std::vector<Result> simulateAll(std::uint64_t fights, std::uint64_t seed, unsigned threadCount = 0);
+
+    /// @return Number of matchups simulateAll() covers.
+    static int matchupCount();
+
+    /**
+     * @brief Maps a simulateAll() index to its matchup.
+     *
+     * Index order: time of day, then item (none first), then player race, then enemy race.
+     *
+     * @param index Index in [0, matchupCount()).
+     * @return The matchup.
+     */
+    static Matchup matchupAt(int index);
+
+    /**
+     * @brief Prints simulateAll() results as one player-by-enemy win-rate matrix
+     *        per time of day and item, each cell "win% +/- 95% interval".
+     * @param out Destination stream.
+     * @param results Results from simulateAll().
+     */
+    static void printMatrix(std::ostream &out, const std::vector<Result> &results);
+
+private:
+    /// Private constructor to prevent instantiation
+    BalanceSimulator() = delete;
+};
+
+#endif // BALANCESIMULATOR_H
@@ -0,0 +1,75 @@
+/**
+ * @file BinaryIO.h
+ * @brief Helpers for reading and writing fixed-size values to binary streams.
+ *
+ * Values are written in host byte order with no padding or conversion, which
+ * is little-endian on every platform the game targets. They are streamed
+ * straight from and into the caller's variables; no intermediate strings
+ * are built.
+ */
+
+#ifndef BINARYIO_H
+#define BINARYIO_H
+
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+/**
+ * @namespace BinaryIO
+ * @brief Raw read/write of trivially copyable values and arrays.
+ */
+namespace BinaryIO {
+
+/**
+ * @brief Writes one trivially copyable value.
+ * @param out Destination stream.
+ * @param value Value to write.
+ */
+template <typename T>
+void write(std::ostream &out, const T &value) {
+    static_assert(std::is_trivially_copyable<T>::value, "raw write needs a trivially copyable type");
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/**
+ * @brief Writes count contiguous trivially copyable values.
+ * @param out Destination stream.
+ * @param values First value.
+ * @param count Number of values.
+ */
+template <typename T>
+void writeArray(std::ostream &out, const T *values, size_t count) {
+    static_assert(std::is_trivially_copyable<T>::value, "raw write needs a trivially copyable type");
+    out.write(reinterpret_cast<const char *>(values), static_cast<std::streamsize>(sizeof(T) * count));
+}
+
+/**
+ * @brief Reads one trivially copyable value.
+ * @param in Source stream.
+ * @param value Receives the value.
+ * @return true if the full value was read.
+ */
+template <typename T>
+bool read(std::istream &in, T &value) {
+    static_assert(std::is_trivially_copyable<T>::value, "raw read needs a trivially copyable type");
+    return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+/**
+ * @brief Reads count contiguous trivially copyable values.
+ * @param in Source stream.
+ * @param values Destination array (at least count elements).
+ * @param count Number of values.
+ * @return true if all values were read.
+ */
+template <typename T>
+bool readArray(std::istream &in, T *values, size_t count) {
+    static_assert(std::is_trivially_copyable<T>::value, "raw read needs a trivially copyable type");
+    return static_cast<bool>(in.read(reinterpret_cast<char *>(values),
+                                     static_cast<std::streamsize>(sizeof(T) * count)));
+}
+
+} // namespace BinaryIO
+
+#endif // BINARYIO_H
@@ -1,235 +1,1031 @@
-#include "Board.h"
-#include "Utility.h"
-#include "Enemy.h"
-#include "Item.h"
-#include "ItemFactory.h"
-#include <iostream>
-
-/**
- * @file Board.cpp
- * @brief Implements the Board class, managing the game grid, player movement, and interactions.
- *
- * Responsibilities:
- *  - Create and initialize a game board of given dimensions.
- *  - Populate squares with random enemies or items.
- *  - Handle player actions: move, pick up, drop, attack.
- *  - Update enemy and player stats based on day/night cycle.
- */
-
-/**
- * @brief Helper function to create a random item.
- * @return std::unique_ptr<Item> pointing to a randomly generated Item.
- *
- * Delegates creation to ItemFactory.
- */
-static std::unique_ptr<Item> createRandomItem() {
-    return ItemFactory::createRandomItem();
-}
-
-/**
- * @brief Constructs a Board with the specified width and height.
- * @param width Width of the board.
- * @param height Height of the board.
- *
- * Initializes all squares as empty BoardSquare objects.
- */
-Board::Board(int width, int height)
-    : width_(width), height_(height)
-{
-    grid_.resize(height_);
-    for (int y = 0; y < height_; ++y) {
-        grid_[y].resize(width_);
-        for (int x = 0; x < width_; ++x) {
-            grid_[y][x] = std::make_unique<BoardSquare>();
-        }
-    }
-}
-
-/**
- * @brief Initializes the board by populating each square.
- */
-void Board::initialize()
-{
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            populateSquare(x, y);
-        }
-    }
-}
-
-/**
- * @brief Populates a single square with an enemy, item, or leaves it empty.
- * @param x X-coordinate of the square.
- * @param y Y-coordinate of the square.
- */
-void Board::populateSquare(int x, int y)
-{
-    int c = Utility::randInt(0, 2);
-    if (c == 0) {
-        auto e = Enemy::createRandomEnemy();
-        if (e) {
-            e->updateForTime(Utility::isNight());
-            grid_[y][x]->placeEnemy(std::move(e));
-        }
-    } else if (c == 1) {
-        auto item = createRandomItem();
-        if (item) grid_[y][x]->placeItem(std::move(item));
-    }
-}
-
-/**
- * @brief Checks whether the given coordinates are inside the board boundaries.
- * @param x X-coordinate.
- * @param y Y-coordinate.
- * @return True if coordinates are valid, false otherwise.
- */
-bool Board::inBounds(int x, int y) const {
-    return x >= 0 && x < width_ && y >= 0 && y < height_;
-}
-
-/**
- * @brief Moves the player in the specified direction.
- * @param player Reference to the Player.
- * @param direction Character 'N', 'S', 'E', or 'W' representing direction.
- * @return True if the move succeeded, false otherwise.
- *
- * Updates enemy stats if an enemy is present on the new square, and displays the square content.
- */
-bool Board::movePlayer(Player &player, char direction)
-{
-    int x = player.getX();
-    int y = player.getY();
-    char d = static_cast<char>(std::toupper(direction));
-    int nx = x, ny = y;
-    if (d == 'N') ny = y - 1;
-    else if (d == 'S') ny = y + 1;
-    else if (d == 'E') nx = x + 1;
-    else if (d == 'W') nx = x - 1;
-    else {
-        std::cout << "Unknown direction.\n";
-        return false;
-    }
-    if (!inBounds(nx, ny)) {
-        std::cout << "You cannot move that direction (out of bounds).\n";
-        return false;
-    }
-    player.setPosition(nx, ny);
-    BoardSquare *sq = grid_[ny][nx].get();
-    if (sq && sq->hasEnemy()) {
-        Enemy *e = sq->getEnemy();
-        if (e) e->updateForTime(Utility::isNight());
-    }
-    lookAtPlayerSquare(player);
-    return true;
-}
-
-/**
- * @brief Displays the contents of the square where the player is located.
- * @param player Reference to the Player.
- */
-void Board::lookAtPlayerSquare(const Player &player) const
-{
-    int x = player.getX();
-    int y = player.getY();
-    std::cout << grid_[y][x]->look() << "\n";
-}
-
-/**
- * @brief Handles player picking up an item from the current square.
- * @param player Reference to the Player.
- *
- * Transfers ownership if pickup succeeds; otherwise, the item remains on the square.
- */
-void Board::playerPickUp(Player &player)
-{
-    int x = player.getX();
-    int y = player.getY();
-    BoardSquare *sq = grid_[y][x].get();
-    if (!sq) return;
-    if (!sq->hasItem()) {
-        std::cout << "There is no item here to pick up.\n";
-        return;
-    }
-    std::unique_ptr<Item> it = sq->takeItem();
-    if (!player.pickUp(std::move(it))) {
-        sq->placeItem(std::move(it));
-        std::cout << "You cannot carry that item (category/weight). It remains here.\n";
-    } else {
-        std::cout << "Item picked up successfully.\n";
-    }
-}
-
-/**
- * @brief Handles player dropping an item on the current square.
- * @param player Reference to the Player.
- * @param itemToDrop Unique pointer to the item to drop.
- * @return True if dropped successfully, false otherwise.
- */
-bool Board::playerDrop(Player &player, std::unique_ptr<Item> itemToDrop)
-{
-    int x = player.getX();
-    int y = player.getY();
-    BoardSquare *sq = grid_[y][x].get();
-    if (!sq) return false;
-    if (sq->hasItem()) {
-        std::cout << "Square already contains an item.\n";
-        return false;
-    }
-    if (sq->dropItem(std::move(itemToDrop))) {
-        std::cout << "Dropped item on square.\n";
-        return true;
-    }
-    return false;
-}
-
-/**
- * @brief Handles player attacking an enemy on the current square.
- * @param player Reference to the Player.
- *
- * Updates enemy stats, executes attack and counterattack, and handles death and gold rewards.
- */
-void Board::playerAttack(Player &player)
-{
-    int x = player.getX();
-    int y = player.getY();
-    BoardSquare *sq = grid_[y][x].get();
-    if (!sq) return;
-    if (!sq->hasEnemy()) {
-        std::cout << "There is no enemy here to attack.\n";
-        return;
-    }
-    Enemy *e = sq->getEnemy();
-    if (!e) return;
-    e->updateForTime(Utility::isNight());
-    player.attack(e);
-    if (!e->isAlive()) {
-        std::unique_ptr<Enemy> dead = sq->takeEnemy();
-        int reward = dead->getDefenceValueWithItems();
-        player.addGold(reward);
-        std::cout << "Enemy defeated! You gained " << reward << " gold.\n";
-        return;
-    }
-    std::cout << e->getName() << " attempts to counterattack!\n";
-    e->attack(&player);
-    if (!player.isAlive()) {
-        std::cout << "You have been defeated! Game over.\n";
-    }
-}
-
-/**
- * @brief Prints a simple debug view of the board.
- *
- * 'E' represents an enemy, 'I' an item, '.' an empty square.
- */
-void Board::printDebug() const
-{
-    std::cout << "Board debug (" << width_ << "x" << height_ << "):\n";
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            if (grid_[y][x]->hasEnemy()) std::cout << "E ";
-            else if (grid_[y][x]->hasItem()) std::cout << "I ";
-            else std::cout << ". ";
-        }
-        std::cout << "\n";
-    }
-}
+#include "Board.h"
+#include "Utility.h"
+#include "Enemy.h"
+#include "Item.h"
+#include "ItemFactory.h"
+#include "BinaryIO.h"
+#include "CombatOdds.h"
+#include "WorldTemplate.h"
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+#include <utility>
+
+/**
+ * @file Board.cpp
+ * @brief Implements the Board class, managing the game grid, player movement, and interactions.
+ *
+ * Responsibilities:
+ *  - Create and initialize a game board of given dimensions.
+ *  - Populate squares with random enemies or items, chunk by chunk, from a world seed,
+ *    optionally across several worker threads.
+ *  - Generate chunks lazily on first access in CHUNKED mode.
+ *  - Read squares from a shared world template in TEMPLATE mode, copying only
+ *    modified squares and bitmaps into a private overlay.
+ *  - Keep per-chunk enemy/item occupancy bitmaps in sync and answer bulk queries from them.
+ *  - Answer nearest-k and within-radius searches using per-chunk populations as an index.
+ *  - Save and load the board in a compact binary format.
+ *  - Handle player actions: move, pick up, drop, attack.
+ *  - Update enemy and player stats based on day/night cycle.
+ */
+
+/**
+ * @brief Constructs a Board with the specified width and height and a random seed.
+ * @param width Width of the board.
+ * @param height Height of the board.
+ * @param mode Storage mode.
+ */
+Board::Board(int width, int height, BoardMode mode)
+    : Board(width, height, mode, Utility::randomSeed())
+{
+}
+
+/**
+ * @brief Constructs a Board with the specified width, height, mode and world seed.
+ * @param width Width of the board.
+ * @param height Height of the board.
+ * @param mode Storage mode.
+ * @param seed World seed.
+ *
+ * In DENSE mode, initializes all squares as empty BoardSquare objects in a single
+ * allocation. In CHUNKED mode nothing is allocated until a chunk is touched.
+ */
+Board::Board(int width, int height, BoardMode mode, std::uint64_t seed)
+    : width_(width), height_(height),
+    chunksX_((width + CHUNK_SIZE - 1) / CHUNK_SIZE),
+    chunksY_((height + CHUNK_SIZE - 1) / CHUNK_SIZE),
+    mode_(mode), seed_(seed)
+{
+    if (mode_ == BoardMode::DENSE) {
+        squares_.resize(width, height);
+        occupancy_.resize(static_cast<size_t>(chunksX_) * static_cast<size_t>(chunksY_));
+        pools_.resize(occupancy_.size());
+    }
+}
+
+/**
+ * @brief Constructs a TEMPLATE board that reads its squares from a mapped world.
+ * @param world Shared template.
+ *
+ * No squares are allocated; the overlay starts empty.
+ */
+Board::Board(std::shared_ptr<const WorldTemplate> world)
+    : width_(world->getWidth()), height_(world->getHeight()),
+    chunksX_((width_ + CHUNK_SIZE - 1) / CHUNK_SIZE),
+    chunksY_((height_ + CHUNK_SIZE - 1) / CHUNK_SIZE),
+    mode_(BoardMode::TEMPLATE), seed_(0), world_(std::move(world))
+{
+}
+
+/**
+ * @brief Initializes the board by populating each chunk (DENSE mode only).
+ * @param threadCount Number of worker threads; 0 uses std::thread::hardware_concurrency().
+ *
+ * Workers claim chunks from a shared atomic counter. Chunks cover disjoint
+ * squares and each has its own random stream, so no further synchronisation
+ * is needed and the result does not depend on the thread count.
+ */
+void Board::initialize(unsigned threadCount)
+{
+    if (mode_ != BoardMode::DENSE) return;
+    const long long chunkCount = static_cast<long long>(chunksX_) * chunksY_;
+
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+    if (static_cast<long long>(threadCount) > chunkCount) {
+        threadCount = static_cast<unsigned>(std::max(1LL, chunkCount));
+    }
+
+    std::atomic<long long> next{0};
+    auto worker = [&]() {
+        for (long long i = next++; i < chunkCount; i = next++) {
+            const int cx = static_cast<int>(i % chunksX_);
+            const int cy = static_cast<int>(i / chunksX_);
+            populateChunk(cx, cy, [&](int lx, int ly) -> BoardSquare & {
+                return squares_.at(cx * CHUNK_SIZE + lx, cy * CHUNK_SIZE + ly);
+            }, occupancyAt(cx, cy), pools_[static_cast<size_t>(i)]);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+    for (unsigned t = 1; t < threadCount; ++t) workers.emplace_back(worker);
+    worker();
+    for (auto &w : workers) w.join();
+}
+
+/**
+ * @brief Populates the in-bounds squares of one chunk from its own random stream.
+ * @param cx Chunk column.
+ * @param cy Chunk row.
+ * @param localSquare Maps local coordinates (lx, ly) to the stored square.
+ * @param occupancy Bitmaps of the chunk, filled in alongside the squares.
+ * @param pool Pool of the chunk, receiving its enemies and items.
+ *
+ * The chunk is generated in batches: every square's content (enemy, item or
+ * empty) is drawn in one pass, then all the chunk's enemies and all its items,
+ * and finally the squares are filled row by row whatever the storage layout,
+ * so the random stream is consumed in the same order for every layout and mode.
+ */
+template <typename LocalSquare>
+void Board::populateChunk(int cx, int cy, LocalSquare &&localSquare, OccupancyBlock &occupancy,
+                          OccupantPool &pool) const
+{
+    std::mt19937 gen(Utility::deriveSeed(seed_, static_cast<std::uint64_t>(cx),
+                                         static_cast<std::uint64_t>(cy)));
+    const int w = std::min(CHUNK_SIZE, width_ - cx * CHUNK_SIZE);
+    const int h = std::min(CHUNK_SIZE, height_ - cy * CHUNK_SIZE);
+    const size_t count = static_cast<size_t>(w) * static_cast<size_t>(h);
+
+    std::uint8_t contents[CHUNK_SIZE * CHUNK_SIZE];
+    Utility::randIntBatch(gen, CONTENT_ENEMY, CONTENT_EMPTY, contents, count);
+    size_t enemyCount = 0, itemCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        enemyCount += contents[i] == CONTENT_ENEMY;
+        itemCount += contents[i] == CONTENT_ITEM;
+    }
+
+    std::uint32_t enemies[CHUNK_SIZE * CHUNK_SIZE];
+    const Item *items[CHUNK_SIZE * CHUNK_SIZE];
+    pool.generateEnemies(gen, enemyCount, enemies);
+    ItemFactory::generate(gen, itemCount, items);
+
+    const std::uint32_t *nextEnemy = enemies;
+    const Item *const *nextItem = items;
+    for (int ly = 0; ly < h; ++ly) {
+        for (int lx = 0; lx < w; ++lx) {
+            const std::uint8_t content = contents[static_cast<size_t>(ly) * static_cast<size_t>(w) + static_cast<size_t>(lx)];
+            BoardSquare &sq = localSquare(lx, ly);
+            if (content == CONTENT_ENEMY) sq.attachEnemy(*nextEnemy++);
+            else if (content == CONTENT_ITEM) sq.placeItem(*nextItem++);
+            occupancy.set(lx, ly, content == CONTENT_ENEMY, content == CONTENT_ITEM);
+        }
+    }
+}
+
+/**
+ * @brief Builds the map key for a chunk from its coordinates.
+ * @param cx Chunk column.
+ * @param cy Chunk row.
+ * @return 64-bit key with cy in the high and cx in the low half.
+ */
+std::uint64_t Board::chunkKey(int cx, int cy)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cy)) << 32)
+           | static_cast<std::uint32_t>(cx);
+}
+
+/**
+ * @brief Returns a chunk, allocating and populating it on first access.
+ * @param cx Chunk column.
+ * @param cy Chunk row.
+ * @return Reference to the chunk.
+ */
+Board::Chunk &Board::chunkAt(int cx, int cy) const
+{
+    auto found = chunks_.find(chunkKey(cx, cy));
+    if (found != chunks_.end()) return found->second;
+
+    Chunk &chunk = chunks_[chunkKey(cx, cy)];
+    chunk.squares.resize(static_cast<size_t>(CHUNK_SIZE) * CHUNK_SIZE);
+    populateChunk(cx, cy, [&chunk](int lx, int ly) -> BoardSquare & {
+        return chunk.squares[static_cast<size_t>(ly) * CHUNK_SIZE + static_cast<size_t>(lx)];
+    }, chunk.occupancy, chunk.pool);
+    return chunk;
+}
+
+/**
+ * @brief Looks up a chunk's occupancy bitmaps without generating the chunk.
+ * @param cx Chunk column.
+ * @param cy Chunk row.
+ * @return Pointer to the bitmaps, or nullptr if the chunk has not been generated.
+ */
+const OccupancyBlock *Board::findOccupancy(int cx, int cy) const
+{
+    const size_t index = static_cast<size_t>(cy) * static_cast<size_t>(chunksX_) + static_cast<size_t>(cx);
+    if (mode_ == BoardMode::DENSE) return &occupancy_[index];
+    if (mode_ == BoardMode::TEMPLATE) {
+        auto modified = overlayOccupancy_.find(index);
+        return modified != overlayOccupancy_.end() ? &modified->second : &world_->occupancy(cx, cy);
+    }
+    auto found = chunks_.find(chunkKey(cx, cy));
+    return found != chunks_.end() ? &found->second.occupancy : nullptr;
+}
+
+/**
+ * @brief Returns a chunk's occupancy bitmaps, generating the chunk if needed.
+ * @param cx Chunk column.
+ * @param cy Chunk row.
+ * @return Reference to the bitmaps.
+ */
+OccupancyBlock &Board::occupancyAt(int cx, int cy) {
+    if (mode_ == BoardMode::TEMPLATE) {
+        const size_t index = static_cast<size_t>(cy) * static_cast<size_t>(chunksX_) + static_cast<size_t>(cx);
+        auto found = overlayOccupancy_.find(index);
+        if (found == overlayOccupancy_.end()) {
+            found = overlayOccupancy_.emplace(index, world_->occupancy(cx, cy)).first;
+        }
+        return found->second;
+    }
+    return const_cast<OccupancyBlock &>(std::as_const(*this).occupancyAt(cx, cy));
+}
+
+/**
+ * @brief Returns a chunk's occupancy bitmaps (read-only), generating the chunk if needed.
+ * @param cx Chunk column.
+ * @param cy Chunk row.
+ * @return Const reference to the bitmaps.
+ */
+const OccupancyBlock &Board::occupancyAt(int cx, int cy) const {
+    if (mode_ != BoardMode::CHUNKED) return *findOccupancy(cx, cy);
+    return chunkAt(cx, cy).occupancy;
+}
+
+/**
+ * @brief Updates the occupancy bits of one square from its current contents.
+ * @param x X-coordinate.
+ * @param y Y-coordinate.
+ */
+void Board::syncOccupancy(int x, int y)
+{
+    const BoardSquare &sq = squareAt(x, y);
+    occupancyAt(x / CHUNK_SIZE, y / CHUNK_SIZE)
+        .set(x % CHUNK_SIZE, y % CHUNK_SIZE, sq.hasEnemy(), sq.hasItem());
+}
+
+/**
+ * @brief Tests one occupancy bit.
+ * @param kind ENEMY or ITEM.
+ * @param x X-coordinate (must be in bounds).
+ * @param y Y-coordinate (must be in bounds).
+ * @return true if square (x, y) holds that kind of occupant.
+ */
+bool Board::holds(OccupantKind kind, int x, int y) const
+{
+    const OccupancyBlock &block = occupancyAt(x / CHUNK_SIZE, y / CHUNK_SIZE);
+    return (block.rows(kind)[y % CHUNK_SIZE] >> (x % CHUNK_SIZE)) & 1ULL;
+}
+
+/**
+ * @brief Returns the number of chunks that currently hold generated squares.
+ * @return Generated chunk count.
+ */
+size_t Board::generatedChunkCount() const
+{
+    if (mode_ == BoardMode::CHUNKED) return chunks_.size();
+    return static_cast<size_t>(chunksX_) * static_cast<size_t>(chunksY_);
+}
+
+/**
+ * @brief Counts enemies or items by summing per-chunk populations.
+ * @param kind ENEMY or ITEM.
+ * @return Number of occupied squares of that kind (generated chunks only).
+ */
+size_t Board::countOccupants(OccupantKind kind) const
+{
+    size_t total = 0;
+    if (mode_ == BoardMode::DENSE) {
+        for (const OccupancyBlock &block : occupancy_) total += static_cast<size_t>(block.population(kind));
+    } else if (mode_ == BoardMode::TEMPLATE) {
+        for (int cy = 0; cy < chunksY_; ++cy) {
+            for (int cx = 0; cx < chunksX_; ++cx) total += static_cast<size_t>(findOccupancy(cx, cy)->population(kind));
+        }
+    } else {
+        for (const auto &entry : chunks_) total += static_cast<size_t>(entry.second.occupancy.population(kind));
+    }
+    return total;
+}
+
+/**
+ * @brief Tests one bitmap word per chunk along row y.
+ * @param kind ENEMY or ITEM.
+ * @param y Row to test.
+ * @return true if any square of the row holds that kind of occupant.
+ */
+bool Board::anyOccupantInRow(OccupantKind kind, int y) const
+{
+    if (y < 0 || y >= height_) return false;
+    const int cy = y / CHUNK_SIZE;
+    const int ly = y % CHUNK_SIZE;
+    for (int cx = 0; cx < chunksX_; ++cx) {
+        const OccupancyBlock *block = findOccupancy(cx, cy);
+        if (block && block->rows(kind)[ly] != 0) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Counts occupants in a clipped, inclusive rectangle with masked popcounts.
+ * @param kind ENEMY or ITEM.
+ * @param x0 Left column.
+ * @param y0 Top row.
+ * @param x1 Right column (inclusive).
+ * @param y1 Bottom row (inclusive).
+ * @return Number of occupied squares of that kind in the rectangle.
+ */
+size_t Board::countOccupantsInRect(OccupantKind kind, int x0, int y0, int x1, int y1) const
+{
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, width_ - 1);
+    y1 = std::min(y1, height_ - 1);
+    if (x0 > x1 || y0 > y1) return 0;
+
+    size_t total = 0;
+    for (int cy = y0 / CHUNK_SIZE; cy <= y1 / CHUNK_SIZE; ++cy) {
+        const int ly0 = std::max(y0 - cy * CHUNK_SIZE, 0);
+        const int ly1 = std::min(y1 - cy * CHUNK_SIZE, CHUNK_SIZE - 1);
+        for (int cx = x0 / CHUNK_SIZE; cx <= x1 / CHUNK_SIZE; ++cx) {
+            const OccupancyBlock *block = findOccupancy(cx, cy);
+            if (!block) continue;
+            const std::uint64_t mask = Bits::rangeMask(std::max(x0 - cx * CHUNK_SIZE, 0),
+                                                       std::min(x1 - cx * CHUNK_SIZE, CHUNK_SIZE - 1));
+            const std::uint64_t *rows = block->rows(kind);
+            for (int ly = ly0; ly <= ly1; ++ly) {
+                total += static_cast<size_t>(Bits::popcount(rows[ly] & mask));
+            }
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Finds the next occupied square in row-major order using trailing-zero counts.
+ * @param kind ENEMY or ITEM.
+ * @param x In: starting column. Out: column found.
+ * @param y In: starting row. Out: row found.
+ * @return true if found, false if there is no such square at or after (x, y).
+ */
+bool Board::findNextOccupant(OccupantKind kind, int &x, int &y) const
+{
+    if (y < 0) { x = 0; y = 0; }
+    if (x < 0) x = 0;
+    for (int row = y; row < height_; ++row) {
+        const int startX = (row == y) ? x : 0;
+        if (startX >= width_) continue;
+        const int cy = row / CHUNK_SIZE;
+        const int ly = row % CHUNK_SIZE;
+        for (int cx = startX / CHUNK_SIZE; cx < chunksX_; ++cx) {
+            const OccupancyBlock *block = findOccupancy(cx, cy);
+            if (!block) continue;
+            std::uint64_t word = block->rows(kind)[ly];
+            if (cx == startX / CHUNK_SIZE) word &= ~0ULL << (startX % CHUNK_SIZE);
+            if (word != 0) {
+                x = cx * CHUNK_SIZE + Bits::countTrailingZeros(word);
+                y = row;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Orders hits by distance, then row-major position, so results are deterministic.
+ */
+static bool closerHit(const SquareHit &a, const SquareHit &b)
+{
+    if (a.distance != b.distance) return a.distance < b.distance;
+    if (a.y != b.y) return a.y < b.y;
+    return a.x < b.x;
+}
+
+/**
+ * @brief Computes the Manhattan distance from a point to the closest square of a chunk.
+ * @param x Point column.
+ * @param y Point row.
+ * @param cx Chunk column.
+ * @param cy Chunk row.
+ * @return Lower bound on the distance to any occupant of the chunk.
+ */
+int Board::distanceToChunk(int x, int y, int cx, int cy)
+{
+    const int left = cx * CHUNK_SIZE, right = left + CHUNK_SIZE - 1;
+    const int top = cy * CHUNK_SIZE, bottom = top + CHUNK_SIZE - 1;
+    const int dx = x < left ? left - x : (x > right ? x - right : 0);
+    const int dy = y < top ? top - y : (y > bottom ? y - bottom : 0);
+    return dx + dy;
+}
+
+/**
+ * @brief Appends a chunk's occupants within maxDistance of (x, y), one masked word per row.
+ * @param block Bitmaps of the chunk.
+ * @param kind ENEMY or ITEM.
+ * @param cx Chunk column.
+ * @param cy Chunk row.
+ * @param x Origin column.
+ * @param y Origin row.
+ * @param maxDistance Largest Manhattan distance to report.
+ * @param out Receives the hits.
+ */
+void Board::collectChunkHits(const OccupancyBlock &block, OccupantKind kind, int cx, int cy,
+                             int x, int y, int maxDistance, std::vector<SquareHit> &out)
+{
+    const std::uint64_t *rows = block.rows(kind);
+    const int left = cx * CHUNK_SIZE;
+    for (int ly = 0; ly < CHUNK_SIZE; ++ly) {
+        if (rows[ly] == 0) continue;
+        const int gy = cy * CHUNK_SIZE + ly;
+        const int dy = std::abs(gy - y);
+        if (dy > maxDistance) continue;
+        const int reach = maxDistance - dy;
+        const long long from = std::max<long long>(static_cast<long long>(x) - reach - left, 0);
+        const long long to = std::min<long long>(static_cast<long long>(x) + reach - left, CHUNK_SIZE - 1);
+        if (from > to) continue;
+        std::uint64_t word = rows[ly] & Bits::rangeMask(static_cast<int>(from), static_cast<int>(to));
+        while (word != 0) {
+            const int gx = left + Bits::countTrailingZeros(word);
+            out.push_back({gx, gy, std::abs(gx - x) + dy});
+            word &= word - 1;
+        }
+    }
+}
+
+/**
+ * @brief Finds the k closest occupants by searching chunk rings outward from (x, y).
+ * @param kind ENEMY or ITEM.
+ * @param x Origin column.
+ * @param y Origin row.
+ * @param k Maximum number of hits.
+ * @return Up to k hits sorted by distance.
+ */
+std::vector<SquareHit> Board::nearestOccupants(OccupantKind kind, int x, int y, size_t k) const
+{
+    std::vector<SquareHit> best;
+    if (k == 0 || !inBounds(x, y)) return best;
+
+    const int pcx = x / CHUNK_SIZE;
+    const int pcy = y / CHUNK_SIZE;
+    const int maxRing = std::max(std::max(pcx, chunksX_ - 1 - pcx), std::max(pcy, chunksY_ - 1 - pcy));
+
+    auto visit = [&](int cx, int cy) {
+        if (cx < 0 || cy < 0 || cx >= chunksX_ || cy >= chunksY_) return;
+        const int limit = best.size() == k ? best.back().distance : INT_MAX;
+        if (distanceToChunk(x, y, cx, cy) > limit) return;
+        const OccupancyBlock &block = occupancyAt(cx, cy);
+        if (block.population(kind) == 0) return;
+        collectChunkHits(block, kind, cx, cy, x, y, limit, best);
+        std::sort(best.begin(), best.end(), closerHit);
+        if (best.size() > k) best.resize(k);
+    };
+
+    for (int r = 0; r <= maxRing; ++r) {
+        const int ringBound = r == 0 ? 0 : (r - 1) * CHUNK_SIZE + 1;
+        if (best.size() == k && ringBound > best.back().distance) break;
+        if (r == 0) {
+            visit(pcx, pcy);
+            continue;
+        }
+        for (int cx = pcx - r; cx <= pcx + r; ++cx) {
+            visit(cx, pcy - r);
+            visit(cx, pcy + r);
+        }
+        for (int cy = pcy - r + 1; cy <= pcy + r - 1; ++cy) {
+            visit(pcx - r, cy);
+            visit(pcx + r, cy);
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Collects every occupant within a Manhattan radius, skipping empty or distant chunks.
+ * @param kind ENEMY or ITEM.
+ * @param x Origin column.
+ * @param y Origin row.
+ * @param radius Maximum distance (inclusive).
+ * @return Hits sorted by distance.
+ */
+std::vector<SquareHit> Board::occupantsWithinRadius(OccupantKind kind, int x, int y, int radius) const
+{
+    std::vector<SquareHit> hits;
+    if (radius < 0 || !inBounds(x, y)) return hits;
+
+    const int cx0 = std::max(x - radius, 0) / CHUNK_SIZE;
+    const int cy0 = std::max(y - radius, 0) / CHUNK_SIZE;
+    const int cx1 = static_cast<int>(std::min<long long>(static_cast<long long>(x) + radius, width_ - 1) / CHUNK_SIZE);
+    const int cy1 = static_cast<int>(std::min<long long>(static_cast<long long>(y) + radius, height_ - 1) / CHUNK_SIZE);
+    for (int cy = cy0; cy <= cy1; ++cy) {
+        for (int cx = cx0; cx <= cx1; ++cx) {
+            if (distanceToChunk(x, y, cx, cy) > radius) continue;
+            const OccupancyBlock &block = occupancyAt(cx, cy);
+            if (block.population(kind) == 0) continue;
+            collectChunkHits(block, kind, cx, cy, x, y, radius, hits);
+        }
+    }
+    std::sort(hits.begin(), hits.end(), closerHit);
+    return hits;
+}
+
+/**
+ * @brief Checks whether the given coordinates are inside the board boundaries.
+ * @param x X-coordinate.
+ * @param y Y-coordinate.
+ * @return True if coordinates are valid, false otherwise.
+ */
+bool Board::inBounds(int x, int y) const {
+    return x >= 0 && x < width_ && y >= 0 && y < height_;
+}
+
+/**
+ * @brief Returns the square stored at the given coordinates.
+ * @param x X-coordinate (must be in bounds).
+ * @param y Y-coordinate (must be in bounds).
+ * @return Reference to the square (generating its chunk first in CHUNKED mode).
+ */
+BoardSquare &Board::squareAt(int x, int y) {
+    if (mode_ == BoardMode::TEMPLATE) {
+        const size_t index = static_cast<size_t>(y) * static_cast<size_t>(width_) + static_cast<size_t>(x);
+        auto found = overlay_.find(index);
+        if (found == overlay_.end()) {
+            found = overlay_.emplace(index, BoardSquare()).first;
+            found->second.restore(overlayPool_, world_->record(x, y));
+        }
+        return found->second;
+    }
+    return const_cast<BoardSquare &>(*findSquare(x, y));
+}
+
+/**
+ * @brief Returns the square stored at the given coordinates without copying template squares.
+ * @param x X-coordinate (must be in bounds).
+ * @param y Y-coordinate (must be in bounds).
+ * @return The square (generating its chunk first in CHUNKED mode), or nullptr
+ *         for an unmodified TEMPLATE square.
+ */
+const BoardSquare *Board::findSquare(int x, int y) const {
+    if (mode_ == BoardMode::DENSE) return &squares_.at(x, y);
+    if (mode_ == BoardMode::TEMPLATE) {
+        auto found = overlay_.find(static_cast<size_t>(y) * static_cast<size_t>(width_) + static_cast<size_t>(x));
+        return found != overlay_.end() ? &found->second : nullptr;
+    }
+    const Chunk &chunk = chunkAt(x / CHUNK_SIZE, y / CHUNK_SIZE);
+    return &chunk.squares[static_cast<size_t>(y % CHUNK_SIZE) * CHUNK_SIZE + static_cast<size_t>(x % CHUNK_SIZE)];
+}
+
+/**
+ * @brief Returns the pointer-free record of a square.
+ * @param x X-coordinate (must be in bounds).
+ * @param y Y-coordinate (must be in bounds).
+ * @return The record, read from the template for unmodified TEMPLATE squares.
+ */
+SquareRecord Board::recordAt(int x, int y) const {
+    const BoardSquare *sq = findSquare(x, y);
+    return sq ? sq->toRecord(poolAt(x, y)) : world_->record(x, y);
+}
+
+/**
+ * @brief Copies a chunk's records and bitmaps, generating it into scratch storage if needed.
+ * @param cx Chunk column.
+ * @param cy Chunk row.
+ * @param records Receives CHUNK_SIZE * CHUNK_SIZE records.
+ * @param occupancy Receives the bitmaps.
+ */
+void Board::copyChunk(int cx, int cy, SquareRecord *records, OccupancyBlock &occupancy) const
+{
+    std::fill(records, records + CHUNK_SIZE * CHUNK_SIZE, SquareRecord{});
+    const int w = std::min(CHUNK_SIZE, width_ - cx * CHUNK_SIZE);
+    const int h = std::min(CHUNK_SIZE, height_ - cy * CHUNK_SIZE);
+
+    if (mode_ == BoardMode::CHUNKED && !findOccupancy(cx, cy)) {
+        Chunk scratch;
+        scratch.squares.resize(static_cast<size_t>(CHUNK_SIZE) * CHUNK_SIZE);
+        populateChunk(cx, cy, [&scratch](int lx, int ly) -> BoardSquare & {
+            return scratch.squares[static_cast<size_t>(ly) * CHUNK_SIZE + static_cast<size_t>(lx)];
+        }, scratch.occupancy, scratch.pool);
+        for (int ly = 0; ly < h; ++ly) {
+            for (int lx = 0; lx < w; ++lx) {
+                const size_t i = static_cast<size_t>(ly) * CHUNK_SIZE + static_cast<size_t>(lx);
+                records[i] = scratch.squares[i].toRecord(scratch.pool);
+            }
+        }
+        occupancy = scratch.occupancy;
+        return;
+    }
+
+    for (int ly = 0; ly < h; ++ly) {
+        for (int lx = 0; lx < w; ++lx) {
+            records[static_cast<size_t>(ly) * CHUNK_SIZE + static_cast<size_t>(lx)] =
+                recordAt(cx * CHUNK_SIZE + lx, cy * CHUNK_SIZE + ly);
+        }
+    }
+    occupancy = occupancyAt(cx, cy);
+}
+
+/**
+ * @brief Returns a generational handle to the enemy on a square.
+ * @param x X-coordinate.
+ * @param y Y-coordinate.
+ * @return The handle, or a null handle if there is no enemy.
+ */
+EnemyHandle Board::enemyHandleAt(int x, int y) {
+    if (!inBounds(x, y) || !holds(OccupantKind::ENEMY, x, y)) return {};
+    return squareAt(x, y).enemyHandle(poolAt(x, y));
+}
+
+/**
+ * @brief Resolves an enemy handle through the pool of its square.
+ * @param x X-coordinate.
+ * @param y Y-coordinate.
+ * @param handle Handle to resolve.
+ * @return The enemy, or nullptr if the handle is null or stale.
+ */
+Enemy *Board::resolveEnemy(int x, int y, EnemyHandle handle) {
+    return inBounds(x, y) ? poolAt(x, y).resolve(handle) : nullptr;
+}
+
+/// @copydoc Board::resolveEnemy(int, int, EnemyHandle)
+const Enemy *Board::resolveEnemy(int x, int y, EnemyHandle handle) const {
+    return inBounds(x, y) ? poolAt(x, y).resolve(handle) : nullptr;
+}
+
+/**
+ * @brief Returns the pool that owns the occupant of a square.
+ * @param x X-coordinate (must be in bounds).
+ * @param y Y-coordinate (must be in bounds).
+ * @return Reference to the pool.
+ */
+OccupantPool &Board::poolAt(int x, int y) {
+    return const_cast<OccupantPool &>(std::as_const(*this).poolAt(x, y));
+}
+
+/**
+ * @brief Returns the pool that owns the occupant of a square (read-only).
+ * @param x X-coordinate (must be in bounds).
+ * @param y Y-coordinate (must be in bounds).
+ * @return Const reference to the pool (generating its chunk first in CHUNKED mode).
+ */
+const OccupantPool &Board::poolAt(int x, int y) const {
+    const int cx = x / CHUNK_SIZE, cy = y / CHUNK_SIZE;
+    if (mode_ == BoardMode::DENSE) {
+        return pools_[static_cast<size_t>(cy) * static_cast<size_t>(chunksX_) + static_cast<size_t>(cx)];
+    }
+    if (mode_ == BoardMode::TEMPLATE) return overlayPool_;
+    return chunkAt(cx, cy).pool;
+}
+
+/**
+ * @brief Moves the player in the specified direction.
+ * @param player Reference to the Player.
+ * @param direction Character 'N', 'S', 'E', or 'W' representing direction.
+ * @return True if the move succeeded, false otherwise.
+ *
+ * Updates enemy stats if an enemy is present on the new square, and displays the square content.
+ */
+bool Board::movePlayer(Player &player, char direction)
+{
+    int x = player.getX();
+    int y = player.getY();
+    char d = static_cast<char>(std::toupper(direction));
+    int nx = x, ny = y;
+    if (d == 'N') ny = y - 1;
+    else if (d == 'S') ny = y + 1;
+    else if (d == 'E') nx = x + 1;
+    else if (d == 'W') nx = x - 1;
+    else {
+        std::cout << "Unknown direction.\n";
+        return false;
+    }
+    if (!inBounds(nx, ny)) {
+        std::cout << "You cannot move that direction (out of bounds).\n";
+        return false;
+    }
+    player.setPosition(nx, ny);
+    const BoardSquare *sq = findSquare(nx, ny);
+    if (sq && sq->hasEnemy()) {
+        Enemy *e = sq->getEnemy(poolAt(nx, ny));
+        if (e) e->updateForTime(Utility::isNight());
+    }
+    lookAtPlayerSquare(player);
+    return true;
+}
+
+/**
+ * @brief Displays the contents of the square where the player is located.
+ * @param player Reference to the Player.
+ *
+ * The line is formatted into a stack buffer, so looking allocates no heap memory.
+ */
+void Board::lookAtPlayerSquare(const Player &player) const
+{
+    int x = player.getX();
+    int y = player.getY();
+    char line[BoardSquare::LOOK_BUFFER_SIZE];
+    const BoardSquare *sq = findSquare(x, y);
+    const size_t length = sq ? sq->look(poolAt(x, y), line, sizeof(line))
+                             : BoardSquare::look(world_->record(x, y), line, sizeof(line));
+    std::cout.write(line, static_cast<std::streamsize>(length));
+
+    // Odds of attacking the enemy here; memoised, so O(1) once the matchup has been seen
+    const bool night = Utility::isNight();
+    CombatOdds::Odds odds;
+    bool enemyHere = false;
+    if (sq) {
+        if (const Enemy *e = sq->getEnemy(poolAt(x, y))) {
+            // Its stats may predate the last day/night switch, so judge an up-to-date copy
+            Enemy current = *e;
+            current.updateForTime(night);
+            odds = CombatOdds::of(player, current, night);
+            enemyHere = true;
+        }
+    } else {
+        const SquareRecord record = world_->record(x, y);
+        if (record.kind == SquareRecord::ENEMY && record.code < Constants::RACE_COUNT) {
+            Enemy e(record.code);
+            e.updateForTime(night);
+            e.setHealth(record.health);
+            odds = CombatOdds::of(player, e, night);
+            enemyHere = true;
+        }
+    }
+    if (enemyHere) std::cout << ", win chance " << static_cast<int>(std::lround(100.0 * odds.win)) << "%";
+    std::cout << "\n";
+}
+
+/**
+ * @brief Handles player picking up an item from the current square.
+ * @param player Reference to the Player.
+ *
+ * Moves the item into the inventory if pickup succeeds; otherwise, the item remains on the square.
+ */
+void Board::playerPickUp(Player &player)
+{
+    int x = player.getX();
+    int y = player.getY();
+    if (!holds(OccupantKind::ITEM, x, y)) {
+        std::cout << "There is no item here to pick up.\n";
+        return;
+    }
+    BoardSquare &sq = squareAt(x, y);
+    if (!player.canPickUp(*sq.getItem())) {
+        std::cout << "You cannot carry that item (category/weight). It remains here.\n";
+        return;
+    }
+    player.pickUp(sq.takeItem());
+    std::cout << "Item picked up successfully.\n";
+    syncOccupancy(x, y);
+}
+
+/**
+ * @brief Handles player dropping an item on the current square.
+ * @param player Reference to the Player.
+ * @param itemToDrop The catalogue item to drop.
+ * @return True if dropped successfully, false otherwise.
+ */
+bool Board::playerDrop(Player &player, const Item *itemToDrop)
+{
+    int x = player.getX();
+    int y = player.getY();
+    if (holds(OccupantKind::ITEM, x, y)) {
+        std::cout << "Square already contains an item.\n";
+        return false;
+    }
+    if (holds(OccupantKind::ENEMY, x, y)) {
+        std::cout << "An enemy is standing on this square.\n";
+        return false;
+    }
+    BoardSquare &sq = squareAt(x, y);
+    if (sq.dropItem(itemToDrop)) {
+        syncOccupancy(x, y);
+        std::cout << "Dropped item on square.\n";
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Handles player attacking an enemy on the current square.
+ * @param player Reference to the Player.
+ *
+ * Updates enemy stats, executes attack and counterattack, and handles death and gold rewards.
+ */
+void Board::playerAttack(Player &player)
+{
+    int x = player.getX();
+    int y = player.getY();
+    if (!holds(OccupantKind::ENEMY, x, y)) {
+        std::cout << "There is no enemy here to attack.\n";
+        return;
+    }
+    BoardSquare &sq = squareAt(x, y);
+    OccupantPool &pool = poolAt(x, y);
+    Enemy *e = sq.getEnemy(pool);
+    if (!e) return;
+    e->updateForTime(Utility::isNight());
+    CombatEventSink &sink = *combatSink_;
+    player.attack(e, sink);
+    if (!e->isAlive()) {
+        CombatEvent defeated;
+        defeated.type = CombatEventType::ENEMY_DEFEATED;
+        defeated.gold = e->getDefenceValueWithItems();
+        sq.takeEnemy(pool);
+        syncOccupancy(x, y);
+        player.addGold(defeated.gold);
+        sink.record(defeated);
+        return;
+    }
+    CombatEvent counter;
+    counter.type = CombatEventType::COUNTERATTACK;
+    counter.attacker = e->getName();
+    sink.record(counter);
+    e->attack(&player, sink);
+    if (!player.isAlive()) {
+        CombatEvent lost;
+        lost.type = CombatEventType::PLAYER_DEFEATED;
+        sink.record(lost);
+    }
+}
+
+/**
+ * @brief Resolves a whole fight on the player's square without any output.
+ * @param player Reference to the Player.
+ * @return The summary.
+ */
+FightSummary Board::playerFight(Player &player)
+{
+    FightSummary summary;
+    const int x = player.getX();
+    const int y = player.getY();
+    if (!holds(OccupantKind::ENEMY, x, y)) return summary;
+    BoardSquare &sq = squareAt(x, y);
+    OccupantPool &pool = poolAt(x, y);
+    Enemy *e = sq.getEnemy(pool);
+    if (!e) return summary;
+    e->updateForTime(Utility::isNight());
+    summary.fought = true;
+
+    while (summary.rounds < Constants::MAX_FIGHT_ROUNDS) {
+        ++summary.rounds;
+        const CombatOutcome strike = player.resolveAttack(*e);
+        summary.damageDealt += strike.damage;
+        if (strike.killed) break;
+        const CombatOutcome counter = e->resolveAttack(player);
+        summary.damageTaken += counter.damage;
+        if (counter.killed) break;
+    }
+
+    summary.won = !e->isAlive();
+    summary.lost = !player.isAlive();
+    if (summary.won) {
+        summary.gold = e->getDefenceValueWithItems();
+        sq.takeEnemy(pool);
+        syncOccupancy(x, y);
+        player.addGold(summary.gold);
+    }
+    return summary;
+}
+
+/**
+ * @brief Prints a simple debug view of the board.
+ *
+ * 'E' represents an enemy, 'I' an item, '.' an empty square. Reads the
+ * occupancy bitmaps rather than the squares themselves.
+ */
+void Board::printDebug() const
+{
+    std::cout << "Board debug (" << width_ << "x" << height_ << "):\n";
+    for (int y = 0; y < height_; ++y) {
+        const int ly = y % CHUNK_SIZE;
+        for (int x = 0; x < width_; ++x) {
+            const OccupancyBlock &block = occupancyAt(x / CHUNK_SIZE, y / CHUNK_SIZE);
+            const std::uint64_t bit = 1ULL << (x % CHUNK_SIZE);
+            if (block.enemies[ly] & bit) std::cout << "E ";
+            else if (block.items[ly] & bit) std::cout << "I ";
+            else std::cout << ". ";
+        }
+        std::cout << "\n";
+    }
+}
+
+/**
+ * @brief Writes the board's dimensions, seed and square records to a binary stream.
+ * @param out Destination stream.
+ */
+void Board::save(std::ostream &out) const
+{
+    BinaryIO::write(out, static_cast<std::int32_t>(width_));
+    BinaryIO::write(out, static_cast<std::int32_t>(height_));
+    // A template too big for a DENSE save is written as a CHUNKED one holding every chunk
+    const bool dense = mode_ == BoardMode::DENSE
+                       || (mode_ == BoardMode::TEMPLATE
+                           && static_cast<long long>(width_) * height_ <= Constants::MAX_DENSE_SQUARES);
+    BinaryIO::write(out, static_cast<std::uint8_t>(dense ? BoardMode::DENSE : BoardMode::CHUNKED));
+    BinaryIO::write(out, seed_);
+
+    if (dense) {
+        std::vector<SquareRecord> row(static_cast<size_t>(width_));
+        for (int y = 0; y < height_; ++y) {
+            for (int x = 0; x < width_; ++x) row[static_cast<size_t>(x)] = recordAt(x, y);
+            BinaryIO::writeArray(out, row.data(), row.size());
+        }
+        return;
+    }
+
+    std::vector<SquareRecord> records(static_cast<size_t>(CHUNK_SIZE) * CHUNK_SIZE);
+    if (mode_ == BoardMode::TEMPLATE) {
+        BinaryIO::write(out, static_cast<std::uint64_t>(chunksX_) * static_cast<std::uint64_t>(chunksY_));
+        for (int cy = 0; cy < chunksY_; ++cy) {
+            for (int cx = 0; cx < chunksX_; ++cx) {
+                BinaryIO::write(out, static_cast<std::int32_t>(cx));
+                BinaryIO::write(out, static_cast<std::int32_t>(cy));
+                for (int ly = 0; ly < CHUNK_SIZE; ++ly) {
+                    for (int lx = 0; lx < CHUNK_SIZE; ++lx) {
+                        const int x = cx * CHUNK_SIZE + lx, y = cy * CHUNK_SIZE + ly;
+                        records[static_cast<size_t>(ly) * CHUNK_SIZE + static_cast<size_t>(lx)] =
+                            inBounds(x, y) ? recordAt(x, y) : SquareRecord{};
+                    }
+                }
+                BinaryIO::writeArray(out, records.data(), records.size());
+            }
+        }
+        return;
+    }
+
+    BinaryIO::write(out, static_cast<std::uint64_t>(chunks_.size()));
+    for (const auto &entry : chunks_) {
+        BinaryIO::write(out, static_cast<std::int32_t>(entry.first & 0xFFFFFFFFu));
+        BinaryIO::write(out, static_cast<std::int32_t>(entry.first >> 32));
+        for (size_t i = 0; i < records.size(); ++i) records[i] = entry.second.squares[i].toRecord(entry.second.pool);
+        BinaryIO::writeArray(out, records.data(), records.size());
+    }
+}
+
+/**
+ * @brief Reads a board written by save().
+ * @param in Source stream.
+ * @return The board, or nullptr on truncated or invalid data.
+ *
+ * The header is checked before anything is allocated, so a corrupt or
+ * hostile file cannot request an oversized board.
+ */
+std::unique_ptr<Board> Board::load(std::istream &in)
+{
+    std::int32_t width = 0, height = 0;
+    std::uint8_t mode = 0;
+    std::uint64_t seed = 0;
+    if (!BinaryIO::read(in, width) || !BinaryIO::read(in, height)
+        || !BinaryIO::read(in, mode) || !BinaryIO::read(in, seed)) return nullptr;
+    if (width <= 0 || height <= 0 || width > Constants::MAX_BOARD_SIDE || height > Constants::MAX_BOARD_SIDE
+        || mode > static_cast<std::uint8_t>(BoardMode::CHUNKED)) return nullptr;
+    if (mode == static_cast<std::uint8_t>(BoardMode::DENSE)
+        && static_cast<long long>(width) * height > Constants::MAX_DENSE_SQUARES) return nullptr;
+
+    auto board = std::make_unique<Board>(width, height, static_cast<BoardMode>(mode), seed);
+
+    if (board->mode_ == BoardMode::DENSE) {
+        // One band of CHUNK_SIZE rows at a time, restored chunk by chunk straight
+        // into the chunk's squares, pool and occupancy block
+        std::vector<SquareRecord> band(static_cast<size_t>(CHUNK_SIZE) * static_cast<size_t>(width));
+        for (int cy = 0; cy < board->chunksY_; ++cy) {
+            const int rows = std::min(CHUNK_SIZE, height - cy * CHUNK_SIZE);
+            if (!BinaryIO::readArray(in, band.data(), static_cast<size_t>(rows) * static_cast<size_t>(width))) return nullptr;
+            for (int cx = 0; cx < board->chunksX_; ++cx) {
+                const size_t index = static_cast<size_t>(cy) * static_cast<size_t>(board->chunksX_) + static_cast<size_t>(cx);
+                OccupantPool &pool = board->pools_[index];
+                OccupancyBlock &occupancy = board->occupancy_[index];
+                const int columns = std::min(CHUNK_SIZE, width - cx * CHUNK_SIZE);
+                for (int ly = 0; ly < rows; ++ly) {
+                    const SquareRecord *row = &band[static_cast<size_t>(ly) * static_cast<size_t>(width)
+                                                    + static_cast<size_t>(cx) * CHUNK_SIZE];
+                    for (int lx = 0; lx < columns; ++lx) {
+                        BoardSquare &sq = board->squares_.at(cx * CHUNK_SIZE + lx, cy * CHUNK_SIZE + ly);
+                        if (!sq.restore(pool, row[lx])) return nullptr;
+                        occupancy.set(lx, ly, sq.hasEnemy(), sq.hasItem());
+                    }
+                }
+            }
+        }
+        return board;
+    }
+
+    std::uint64_t chunkCount = 0;
+    if (!BinaryIO::read(in, chunkCount)) return nullptr;
+    if (chunkCount > static_cast<std::uint64_t>(board->chunksX_) * static_cast<std::uint64_t>(board->chunksY_)) return nullptr;
+    std::vector<SquareRecord> records(static_cast<size_t>(CHUNK_SIZE) * CHUNK_SIZE);
+    for (std::uint64_t i = 0; i < chunkCount; ++i) {
+        std::int32_t cx = 0, cy = 0;
+        if (!BinaryIO::read(in, cx) || !BinaryIO::read(in, cy)) return nullptr;
+        if (cx < 0 || cy < 0 || cx >= board->chunksX_ || cy >= board->chunksY_) return nullptr;
+        if (board->chunks_.find(chunkKey(cx, cy)) != board->chunks_.end()) return nullptr;
+        if (!BinaryIO::readArray(in, records.data(), records.size())) return nullptr;
+
+        Chunk &chunk = board->chunks_[chunkKey(cx, cy)];
+        chunk.squares.resize(records.size());
+        for (int ly = 0; ly < CHUNK_SIZE; ++ly) {
+            for (int lx = 0; lx < CHUNK_SIZE; ++lx) {
+                // Squares of an edge chunk that lie past the board must stay empty
+                if ((cx * CHUNK_SIZE + lx >= width || cy * CHUNK_SIZE + ly >= height)
+                    && records[static_cast<size_t>(ly) * CHUNK_SIZE + static_cast<size_t>(lx)].kind != SquareRecord::EMPTY) {
+                    return nullptr;
+                }
+                BoardSquare &sq = chunk.squares[static_cast<size_t>(ly) * CHUNK_SIZE + static_cast<size_t>(lx)];
+                if (!sq.restore(chunk.pool, records[static_cast<size_t>(ly) * CHUNK_SIZE + static_cast<size_t>(lx)])) return nullptr;
+                chunk.occupancy.set(lx, ly, sq.hasEnemy(), sq.hasItem());
+            }
+        }
+    }
+    return board;
+}
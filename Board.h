@@ -1,204 +1,736 @@
-/**
- * @file Board.h
- * @brief Declares the Board class, which manages the 2D grid and all player–square interactions.
- *
- * The Board class stores a dynamic 2D grid of BoardSquare objects. It provides
- * methods that support player movement, combat interactions, item pickup/drop,
- * and examining the current square. The board is populated randomly at the start
- * of the game with enemies and items according to game rules.
- *
- * The Board uses std::unique_ptr<BoardSquare> to model exclusive ownership of each square.
- */
-
-#ifndef BOARD_H
-#define BOARD_H
-
-#include <vector>
-#include <memory>
-#include "BoardSquare.h"
-#include "Player.h"
-
-/**
- * @class Board
- * @brief Represents the dynamic 2D game board on which players move.
- *
- * The Board is responsible for:
- * - Initializing a grid of BoardSquare objects.
- * - Randomly populating squares with items and enemies.
- * - Handling all operations related to a Player's interaction with the board:
- *   movement, pickup, drop, and attack.
- * - Ensuring that movements occur only within bounds and that interactions
- *   correspond to the Player's current position.
- *
- * Internally, the board is implemented as:
- * `std::vector<std::vector<std::unique_ptr<BoardSquare>>>`
- * which gives each square unique ownership and prevents accidental sharing.
- */
-class Board {
-public:
-
-    /**
-     * @brief Constructs a board with a given width and height.
-     *
-     * @param width Width of the board (columns).
-     * @param height Height of the board (rows).
-     *
-     * The constructor allocates the underlying 2D grid but does not populate
-     * items/enemies. Call initialize() after construction.
-     */
-    Board(int width, int height);
-
-    ~Board() = default;
-
-    /**
-     * @brief Randomly populates the entire board with items and enemies.
-     *
-     * PSEUDOCODE:
-     * 1. Loop over all x from 0..width-1:
-     * 2.   Loop over all y from 0..height-1:
-     * 3.       Call populateSquare(x, y)
-     *
-     * populateSquare():
-     * - Random chance to place an item OR an enemy OR leave empty.
-     * - Ensures only one occupant per square.
-     *
-     * @note This should be called once after constructing the board.
-     */
-    void initialize();
-
-    /**
-     * @brief Moves the player one step in the given direction.
-     *
-     * @param player Reference to the player.
-     * @param direction One of {'N','S','E','W'} or lowercase variants.
-     * @return true if movement succeeded, false if out of bounds.
-     *
-     * PSEUDOCODE:
-     * 1. Convert direction into (dx, dy).
-     * 2. newX = player.x + dx
-     *    newY = player.y + dy
-     * 3. If NOT inBounds(newX, newY): return false.
-     * 4. Update player's internal position.
-     * 5. Return true.
-     *
-     * @note Combat or square interaction is NOT triggered here; those are
-     *       handled in other functions based on player's location.
-     */
-    bool movePlayer(Player &player, char direction);
-
-    /**
-     * @brief Prints information about the BoardSquare where the player stands.
-     *
-     * @param player Const reference to the Player.
-     *
-     * PSEUDOCODE:
-     * 1. Locate the player's current (x, y).
-     * 2. Access grid_[y][x].
-     * 3. Print:
-     *      - Whether it contains an item (and its name)
-     *      - Whether it contains an enemy (and its stats)
-     *      - Whether the square is empty
-     */
-    void lookAtPlayerSquare(const Player &player) const;
-
-    /**
-     * @brief Allows the player to pick up an item from the current square.
-     *
-     * @param player Reference to Player.
-     *
-     * PSEUDOCODE:
-     * 1. Locate player's square.
-     * 2. If square has no item → print "Nothing to pick up".
-     * 3. Otherwise:
-     *       - Check player's carry capacity (weight vs strength).
-     *       - Check if item type already equipped (for armour/weapon/shield).
-     *       - If valid: transfer unique_ptr<Item> from the square to player's inventory.
-     * 4. Remove the item from the square.
-     */
-    void playerPickUp(Player &player);
-
-    /**
-     * @brief Drops an item from the player's inventory into the current square.
-     *
-     * @param player Reference to Player.
-     * @param itemToDrop Unique pointer to the Item being dropped.
-     * @return true if drop succeeded, false otherwise.
-     *
-     * PSEUDOCODE:
-     * 1. Locate player's square.
-     * 2. If square already contains an item or enemy → return false.
-     * 3. Place `itemToDrop` into the square.
-     * 4. Remove it from player inventory.
-     * 5. Return true.
-     *
-     * @note BoardSquare can only hold ONE occupant (enemy OR item).
-     */
-    bool playerDrop(Player &player, std::unique_ptr<Item> itemToDrop);
-
-    /**
-     * @brief Executes an attack action from the player to the enemy in the same square.
-     *
-     * @param player Reference to Player initiating the attack.
-     *
-     * PSEUDOCODE:
-     * 1. Locate player's square.
-     * 2. If no enemy present → print "No enemy here".
-     * 3. Call player.attack(enemy).
-     * 4. If enemy's health <= 0:
-     *        - Award gold to player.
-     *        - Remove enemy from square.
-     * 5. If enemy survives and is allowed to counterattack:
-     *        - Call enemy.attack(player)
-     */
-    void playerAttack(Player &player);
-
-    /**
-     * @brief Prints the entire board state for debugging.
-     *
-     * Each square may show:
-     * - 'P' for player
-     * - 'E' for enemy
-     * - 'I' for item
-     * - '.' for empty
-     *
-     * This function is used during development only.
-     */
-    void printDebug() const;
-
-private:
-    int width_;   ///< Number of columns in the board.
-    int height_;  ///< Number of rows in the board.
-
-    /**
-     * @brief The grid storing all board squares.
-     *
-     * grid_[y][x] → unique_ptr<BoardSquare>
-     */
-    std::vector<std::vector<std::unique_ptr<BoardSquare>>> grid_;
-
-    /**
-     * @brief Checks whether the coordinate (x, y) lies inside the board.
-     *
-     * @return true if valid, false if out of bounds.
-     *
-     * PSEUDOCODE:
-     * return (0 <= x < width_) AND (0 <= y < height_)
-     */
-    bool inBounds(int x, int y) const;
-
-    /**
-     * @brief Randomly assigns content to a square (enemy, item, or empty).
-     *
-     * PSEUDOCODE:
-     * 1. Generate random number in range [0, 99].
-     * 2. If < threshold → place enemy.
-     * 3. Else if < another threshold → place item.
-     * 4. Else → leave empty.
-     *
-     * @param x X coordinate of the square.
-     * @param y Y coordinate of the square.
-     */
-    void populateSquare(int x, int y);
-};
-
-#endif // BOARD_H
+/**
+ * @file Board.h
+ * @brief Declares the Board class, which manages the 2D grid and all player–square interactions.
+ *
+ * The Board class stores a dynamic 2D grid of BoardSquare objects. It provides
+ * methods that support player movement, combat interactions, item pickup/drop,
+ * and examining the current square. The board is populated randomly at the start
+ * of the game with enemies and items according to game rules.
+ *
+ * The Board stores its squares by value in one contiguous array, so
+ * constructing a board is a single allocation and neighbouring squares share
+ * cache lines. The array is row-major by default; building with
+ * FBG_MORTON_LAYOUT defined switches it to a tiled Z-order layout (see
+ * SquareGrid.h) that keeps vertical neighbours close as well. Very large
+ * boards can instead be built in chunked mode, where 64x64 chunks are
+ * allocated and generated lazily the first time they are touched.
+ *
+ * Alongside the squares, the Board keeps packed enemy and item occupancy bitmaps
+ * (one OccupancyBlock per chunk) so that board-wide questions are answered by
+ * word-wide popcount scans instead of visiting every square. The per-chunk
+ * population counters double as a spatial index for nearest-occupant and
+ * within-radius searches.
+ *
+ * A board can also be opened over a memory-mapped WorldTemplate. It then reads
+ * squares and bitmaps straight from the shared mapping and keeps only the
+ * squares and blocks it has modified in a private copy-on-write overlay.
+ */
+
+#ifndef BOARD_H
+#define BOARD_H
+
+#include <vector>
+#include <memory>
+#include <iosfwd>
+#include <random>
+#include <cstdint>
+#include <unordered_map>
+#include "BoardSquare.h"
+#include "Occupancy.h"
+#include "OccupantPool.h"
+#include "Player.h"
+#include "SquareGrid.h"
+
+class WorldTemplate;
+
+/**
+ * @brief Square layout of DENSE boards, fixed at compile time.
+ *
+ * Define FBG_MORTON_LAYOUT to store squares in 64x64 Z-order tiles instead of
+ * plain rows.
+ */
+#ifdef FBG_MORTON_LAYOUT
+using BoardLayout = MortonLayout;
+#else
+using BoardLayout = RowMajorLayout;
+#endif
+
+/**
+ * @enum BoardMode
+ * @brief Selects how the Board stores and generates its squares.
+ *
+ * DENSE   – One contiguous array; initialize() populates every square up front.
+ * CHUNKED – Squares live in CHUNK_SIZE x CHUNK_SIZE chunks that are allocated
+ *           and populated only the first time something touches them.
+ * TEMPLATE – Squares are read from a shared, read-only WorldTemplate; squares
+ *            the session modifies are copied into a private overlay first.
+ */
+enum class BoardMode { DENSE, CHUNKED, TEMPLATE };
+
+/**
+ * @struct SquareHit
+ * @brief A square located by a Board spatial query.
+ *
+ * distance is the Manhattan distance (number of N/S/E/W steps) from the
+ * query origin.
+ */
+struct SquareHit {
+    int x;        ///< Column of the square.
+    int y;        ///< Row of the square.
+    int distance; ///< Manhattan distance from the query origin.
+};
+
+/**
+ * @struct FightSummary
+ * @brief What a fight fought to the end (Board::playerFight) came to.
+ */
+struct FightSummary {
+    bool fought = false;  ///< False if there was no enemy to fight.
+    bool won = false;     ///< The enemy was killed.
+    bool lost = false;    ///< The player was killed.
+    int rounds = 0;       ///< Rounds fought (player attack plus any counterattack).
+    int damageDealt = 0;  ///< Health the enemy lost.
+    int damageTaken = 0;  ///< Health the player lost.
+    int gold = 0;         ///< Gold awarded for the kill.
+};
+
+/**
+ * @class Board
+ * @brief Represents the dynamic 2D game board on which players move.
+ *
+ * The Board is responsible for:
+ * - Initializing a grid of BoardSquare objects.
+ * - Randomly populating squares with items and enemies.
+ * - Handling all operations related to a Player's interaction with the board:
+ *   movement, pickup, drop, and attack.
+ * - Ensuring that movements occur only within bounds and that interactions
+ *   correspond to the Player's current position.
+ *
+ * Internally, a dense board is implemented as a flat SquareGrid whose
+ * BoardLayout policy maps (x, y) to an array index.
+ * The Board owns every square directly. Squares are 4-byte handles; the
+ * enemies and items they refer to live in one OccupantPool per chunk.
+ *
+ * Generation is a pure function of (world seed, chunk coordinates): each
+ * CHUNK_SIZE x CHUNK_SIZE chunk draws from its own random stream derived from
+ * the seed, so a dense and a chunked board with the same seed hold the same
+ * squares, whatever order the chunks are visited in.
+ */
+class Board {
+public:
+
+    /// Side length of a generation chunk, in squares.
+    static constexpr int CHUNK_SIZE = 64;
+
+    /**
+     * @brief Constructs a board with a given width and height.
+     *
+     * @param width Width of the board (columns).
+     * @param height Height of the board (rows).
+     * @param mode DENSE (allocate everything now) or CHUNKED (allocate on demand).
+     *
+     * The constructor allocates the underlying 2D grid but does not populate
+     * items/enemies. Call initialize() after construction. The world seed is
+     * chosen at random.
+     */
+    Board(int width, int height, BoardMode mode = BoardMode::DENSE);
+
+    /**
+     * @brief Constructs a board that generates its contents from a fixed seed.
+     *
+     * @param width Width of the board (columns).
+     * @param height Height of the board (rows).
+     * @param mode DENSE or CHUNKED storage.
+     * @param seed World seed; equal seeds produce equal boards.
+     */
+    Board(int width, int height, BoardMode mode, std::uint64_t seed);
+
+    /**
+     * @brief Constructs a TEMPLATE board over a mapped world template.
+     *
+     * Nothing is copied: the board is ready to play immediately and
+     * initialize() does nothing. Several boards may share one template.
+     *
+     * @param world Template to read squares from (must not be null).
+     */
+    explicit Board(std::shared_ptr<const WorldTemplate> world);
+
+    ~Board() = default;
+
+    /**
+     * @brief Randomly populates the entire board with items and enemies.
+     *
+     * PSEUDOCODE:
+     * 1. If mode is CHUNKED: return (chunks are populated when first touched).
+     * 2. Start threadCount workers.
+     * 3. Each worker repeatedly claims the next unclaimed chunk (cx, cy)
+     *    and calls populateChunk(cx, cy, ...) on it.
+     *
+     * populateChunk():
+     * - Each square has an equal chance of an enemy, an item or nothing.
+     * - Ensures only one occupant per square.
+     * - Draws the chunk's contents, enemies and items as three batches.
+     *
+     * Every chunk draws from its own stream derived from the world seed, so the
+     * resulting board is the same whatever the number of threads. Generation
+     * runs in parallel, but its scaling with the thread count has not been
+     * measured (see bench/GenerationBench.cpp).
+     *
+     * @param threadCount Number of worker threads; 0 uses all hardware threads.
+     *
+     * @note This should be called once after constructing the board.
+     */
+    void initialize(unsigned threadCount = 0);
+
+    /**
+     * @brief Moves the player one step in the given direction.
+     *
+     * @param player Reference to the player.
+     * @param direction One of {'N','S','E','W'} or lowercase variants.
+     * @return true if movement succeeded, false if out of bounds.
+     *
+     * PSEUDOCODE:
+     * 1. Convert direction into (dx, dy).
+     * 2. newX = player.x + dx
+     *    newY = player.y + dy
+     * 3. If NOT inBounds(newX, newY): return false.
+     * 4. Update player's internal position.
+     * 5. Return true.
+     *
+     * @note Combat or square interaction is NOT triggered here; those are
+     *       handled in other functions based on player's location.
+     */
+    bool movePlayer(Player &player, char direction);
+
+    /**
+     * @brief Prints information about the BoardSquare where the player stands.
+     *
+     * @param player Const reference to the Player.
+     *
+     * PSEUDOCODE:
+     * 1. Locate the player's current (x, y).
+     * 2. Access squareAt(x, y).
+     * 3. Print:
+     *      - Whether it contains an item (and its name)
+     *      - Whether it contains an enemy (its stats and the chance of winning
+     *        a fight to the end at the current time of day, from CombatOdds)
+     *      - Whether the square is empty
+     */
+    void lookAtPlayerSquare(const Player &player) const;
+
+    /**
+     * @brief Allows the player to pick up an item from the current square.
+     *
+     * @param player Reference to Player.
+     *
+     * PSEUDOCODE:
+     * 1. Locate player's square.
+     * 2. If square has no item → print "Nothing to pick up".
+     * 3. Otherwise:
+     *       - Check player's carry capacity (weight vs strength).
+     *       - Check if item type already equipped (for armour/weapon/shield).
+     *       - If valid: move the item from the square to player's inventory.
+     * 4. Remove the item from the square.
+     */
+    void playerPickUp(Player &player);
+
+    /**
+     * @brief Drops an item from the player's inventory into the current square.
+     *
+     * @param player Reference to Player.
+     * @param itemToDrop The catalogue Item being dropped. On failure the caller
+     *        still holds it, so it can be handed back to the player.
+     * @return true if drop succeeded, false otherwise.
+     *
+     * PSEUDOCODE:
+     * 1. Locate player's square.
+     * 2. If square already contains an item or enemy → return false.
+     * 3. Place `itemToDrop` into the square.
+     * 4. Return true.
+     *
+     * @note BoardSquare can only hold ONE occupant (enemy OR item).
+     */
+    bool playerDrop(Player &player, const Item *itemToDrop);
+
+    /**
+     * @brief Executes an attack action from the player to the enemy in the same square.
+     *
+     * @param player Reference to Player initiating the attack.
+     *
+     * PSEUDOCODE:
+     * 1. Locate player's square.
+     * 2. If no enemy present → print "No enemy here".
+     * 3. Call player.attack(enemy).
+     * 4. If enemy's health <= 0:
+     *        - Award gold to player.
+     *        - Remove enemy from square.
+     * 5. If enemy survives and is allowed to counterattack:
+     *        - Call enemy.attack(player)
+     *
+     * Combat messages go to the combat sink (see setCombatSink()).
+     */
+    void playerAttack(Player &player);
+
+    /**
+     * @brief Fights the enemy on the player's square to the end in one call.
+     *
+     * Plays the same rounds as repeated playerAttack() calls, but the enemy
+     * is looked up and updated for the time of day once, and the loop calls
+     * only Character::resolveAttack: no output, no events, no virtual calls.
+     *
+     * PSEUDOCODE:
+     * 1. If no enemy present → return { fought = false }.
+     * 2. Repeat up to Constants::MAX_FIGHT_ROUNDS rounds:
+     *        - player.resolveAttack(enemy); stop if the enemy dies
+     *        - enemy.resolveAttack(player); stop if the player dies
+     * 3. If the enemy died → award gold and remove it, as playerAttack() does.
+     *
+     * @param player Reference to Player doing the fighting.
+     * @return Rounds, damage dealt and taken, gold and how it ended. If neither
+     *         side won, the round limit was reached and the enemy stays.
+     */
+    FightSummary playerFight(Player &player);
+
+    /**
+     * @brief Chooses where playerAttack() sends its combat events.
+     * @param sink Sink to use, or nullptr for the console (the default). Not owned;
+     *             it must outlive its use by the board.
+     */
+    void setCombatSink(CombatEventSink *sink) { combatSink_ = sink ? sink : &ConsoleCombatSink::instance(); }
+
+    /**
+     * @brief Prints the entire board state for debugging.
+     *
+     * Each square may show:
+     * - 'P' for player
+     * - 'E' for enemy
+     * - 'I' for item
+     * - '.' for empty
+     *
+     * This function is used during development only.
+     *
+     * @note In CHUNKED mode this touches, and therefore generates, every chunk.
+     */
+    void printDebug() const;
+
+    /// @return Number of chunks generated so far (CHUNKED mode), or all chunks (DENSE, TEMPLATE).
+    size_t generatedChunkCount() const;
+
+    /// @return Number of squares copied into the private overlay (TEMPLATE mode), otherwise 0.
+    size_t modifiedSquareCount() const { return overlay_.size(); }
+
+    /**
+     * @brief Returns the pointer-free record of square (x, y).
+     *
+     * In TEMPLATE mode untouched squares are read straight from the mapping.
+     *
+     * @note The coordinate must be in bounds. In CHUNKED mode the containing
+     *       chunk is generated first.
+     */
+    SquareRecord recordAt(int x, int y) const;
+
+    /**
+     * @brief Copies the square records and occupancy bitmaps of chunk (cx, cy).
+     *
+     * Unlike recordAt(), this never keeps a chunk: in CHUNKED mode an
+     * ungenerated chunk is generated into scratch storage, copied out and
+     * discarded, so a whole world can be exported one chunk at a time.
+     *
+     * @param cx Chunk column.
+     * @param cy Chunk row.
+     * @param records Receives CHUNK_SIZE * CHUNK_SIZE records, row by row in
+     *        local coordinates; squares outside the board are EMPTY.
+     * @param occupancy Receives the chunk's bitmaps.
+     */
+    void copyChunk(int cx, int cy, SquareRecord *records, OccupancyBlock &occupancy) const;
+
+    /**
+     * @brief Returns a generational handle to the enemy on square (x, y).
+     *
+     * A handle is 32 bits and can be cached across turns (by bots, spatial
+     * indexes, ...) without dangling. It is relative to the pool of its
+     * square, which the Board picks from the position; enemies never move,
+     * so callers keep the position alongside the handle. In TEMPLATE mode an
+     * untouched enemy square is copied into the overlay first.
+     *
+     * @param x Column.
+     * @param y Row.
+     * @return The handle, or a null handle if (x, y) is out of bounds or holds no enemy.
+     */
+    EnemyHandle enemyHandleAt(int x, int y);
+
+    /**
+     * @brief Resolves an enemy handle in O(1).
+     *
+     * @param x Column the handle was taken at.
+     * @param y Row the handle was taken at.
+     * @param handle Handle from enemyHandleAt().
+     * @return The enemy, or nullptr if the handle is null, stale (the enemy
+     *         was destroyed) or (x, y) is out of bounds.
+     */
+    Enemy *resolveEnemy(int x, int y, EnemyHandle handle);
+
+    /// @copydoc resolveEnemy(int, int, EnemyHandle)
+    const Enemy *resolveEnemy(int x, int y, EnemyHandle handle) const;
+
+    /**
+     * @brief Returns the occupancy bitmaps of chunk (cx, cy).
+     *
+     * @note The chunk must be in bounds. In CHUNKED mode it is generated first.
+     */
+    const OccupancyBlock &chunkOccupancy(int cx, int cy) const { return occupancyAt(cx, cy); }
+
+    /// @return Number of columns.
+    int getWidth() const { return width_; }
+
+    /// @return Number of rows.
+    int getHeight() const { return height_; }
+
+    // ---------------------------------------------------------------------
+    // Persistence
+    // ---------------------------------------------------------------------
+
+    /**
+     * @brief Writes the board to a binary stream.
+     *
+     * Layout (host byte order):
+     *  - int32 width, int32 height, uint8 mode, uint64 seed
+     *  - DENSE:   width * height SquareRecords, row by row
+     *  - CHUNKED: uint64 chunk count, then per generated chunk
+     *             int32 cx, int32 cy, CHUNK_SIZE^2 SquareRecords
+     *
+     * Ungenerated chunks are not written; they regenerate from the seed.
+     * TEMPLATE boards are written as DENSE boards (or, above
+     * Constants::MAX_DENSE_SQUARES squares, as CHUNKED boards holding every
+     * chunk), so a save does not depend on the template file still being present.
+     *
+     * @param out Destination stream.
+     */
+    void save(std::ostream &out) const;
+
+    /**
+     * @brief Reads a board written by save().
+     *
+     * Enemies are adjusted to the current day/night state, so set
+     * Utility's flag before loading.
+     *
+     * Rejected as invalid: a side above Constants::MAX_BOARD_SIDE, a DENSE
+     * board above Constants::MAX_DENSE_SQUARES squares, and a CHUNKED board
+     * listing more chunks than it has, the same chunk twice, or an occupant
+     * in an edge chunk's squares past the board.
+     *
+     * @param in Source stream.
+     * @return The loaded board, or nullptr if the data is truncated or invalid.
+     */
+    static std::unique_ptr<Board> load(std::istream &in);
+
+    // ---------------------------------------------------------------------
+    // Occupancy queries (bitmap scans; never generate chunks)
+    // ---------------------------------------------------------------------
+
+    /**
+     * @brief Counts all enemies or items on the board.
+     *
+     * PSEUDOCODE:
+     * for each generated chunk: total += chunk population of kind
+     *
+     * @param kind ENEMY or ITEM.
+     * @return Number of squares holding that kind of occupant.
+     *
+     * @note In CHUNKED mode only chunks generated so far are counted.
+     */
+    size_t countOccupants(OccupantKind kind) const;
+
+    /**
+     * @brief Checks whether any square of row y holds the given kind of occupant.
+     *
+     * @param kind ENEMY or ITEM.
+     * @param y Row to test.
+     * @return true if at least one square in row y is occupied by kind.
+     */
+    bool anyOccupantInRow(OccupantKind kind, int y) const;
+
+    /**
+     * @brief Counts occupants inside the inclusive rectangle [x0, x1] x [y0, y1].
+     *
+     * The rectangle is clipped to the board. Each chunk row it crosses costs one
+     * masked popcount.
+     *
+     * @param kind ENEMY or ITEM.
+     * @param x0 Left column.
+     * @param y0 Top row.
+     * @param x1 Right column (inclusive).
+     * @param y1 Bottom row (inclusive).
+     * @return Number of occupied squares of that kind in the rectangle.
+     */
+    size_t countOccupantsInRect(OccupantKind kind, int x0, int y0, int x1, int y1) const;
+
+    /**
+     * @brief Finds the next occupied square at or after (x, y) in row-major order.
+     *
+     * PSEUDOCODE:
+     * for each row from y:
+     *     for each chunk word along the row (starting at x on the first row):
+     *         if (word & mask) != 0: x,y = position of lowest set bit; return true
+     * return false
+     *
+     * @param kind ENEMY or ITEM.
+     * @param x In: starting column. Out: column of the square found.
+     * @param y In: starting row. Out: row of the square found.
+     * @return true if a square was found (x, y updated), false otherwise.
+     */
+    bool findNextOccupant(OccupantKind kind, int &x, int &y) const;
+
+    // ---------------------------------------------------------------------
+    // Spatial queries (per-chunk summaries; generate the chunks they search)
+    // ---------------------------------------------------------------------
+
+    /**
+     * @brief Finds the k occupants of a kind closest to (x, y).
+     *
+     * PSEUDOCODE:
+     * 1. Visit chunks in rings of increasing chunk distance around (x, y).
+     * 2. Skip chunks whose population is 0, or whose nearest square is
+     *    already farther than the k-th best hit.
+     * 3. Scan the remaining chunks' bitmap words and keep the k best hits.
+     * 4. Stop once the next ring cannot contain anything closer.
+     *
+     * @param kind ENEMY or ITEM.
+     * @param x Origin column (usually the player's).
+     * @param y Origin row.
+     * @param k Maximum number of hits to return.
+     * @return Up to k hits sorted by distance, then row-major position.
+     */
+    std::vector<SquareHit> nearestOccupants(OccupantKind kind, int x, int y, size_t k) const;
+
+    /**
+     * @brief Finds every occupant of a kind within a Manhattan radius of (x, y).
+     *
+     * Only chunks that intersect the radius and have a non-zero population are
+     * scanned; inside a chunk each row is one masked bitmap word.
+     *
+     * @param kind ENEMY or ITEM.
+     * @param x Origin column.
+     * @param y Origin row.
+     * @param radius Maximum Manhattan distance (inclusive).
+     * @return All hits sorted by distance, then row-major position.
+     */
+    std::vector<SquareHit> occupantsWithinRadius(OccupantKind kind, int x, int y, int radius) const;
+
+private:
+    /**
+     * @brief One lazily generated CHUNK_SIZE x CHUNK_SIZE block of squares.
+     *
+     * squares[ly * CHUNK_SIZE + lx] → BoardSquare (local coordinates)
+     */
+    struct Chunk {
+        std::vector<BoardSquare> squares;
+        OccupancyBlock occupancy; ///< Enemy/item bitmaps of this chunk.
+        OccupantPool pool;        ///< Occupants of this chunk's squares.
+    };
+
+    static_assert(CHUNK_SIZE == OccupancyBlock::SIZE, "one bitmap word per chunk row");
+
+    int width_;          ///< Number of columns in the board.
+    int height_;         ///< Number of rows in the board.
+    int chunksX_;        ///< Number of chunk columns.
+    int chunksY_;        ///< Number of chunk rows.
+    BoardMode mode_;     ///< Storage mode (dense or chunked).
+    std::uint64_t seed_; ///< World seed all chunk streams derive from.
+
+    /**
+     * @brief The grid storing all board squares (DENSE mode only).
+     *
+     * squares_.at(x, y) → BoardSquare, laid out by BoardLayout.
+     */
+    SquareGrid<BoardLayout> squares_;
+
+    /**
+     * @brief Occupancy bitmaps of every chunk (DENSE mode only).
+     *
+     * occupancy_[cy * chunksX_ + cx] → OccupancyBlock
+     */
+    std::vector<OccupancyBlock> occupancy_;
+
+    /**
+     * @brief Occupant pools of every chunk (DENSE mode only).
+     *
+     * pools_[cy * chunksX_ + cx] → OccupantPool. One pool per chunk lets
+     * initialize() fill chunks on several threads without locking.
+     */
+    std::vector<OccupantPool> pools_;
+
+    /**
+     * @brief Chunks generated so far (CHUNKED mode only), keyed by chunkKey(cx, cy).
+     *
+     * Mutable because read-only queries (look, printDebug) may generate chunks.
+     */
+    mutable std::unordered_map<std::uint64_t, Chunk> chunks_;
+
+    /// Shared read-only world (TEMPLATE mode only).
+    std::shared_ptr<const WorldTemplate> world_;
+
+    /**
+     * @brief Squares this session has modified (TEMPLATE mode only).
+     *
+     * overlay_[y * width_ + x] → BoardSquare, copied from the template the
+     * first time the square is accessed for writing.
+     */
+    std::unordered_map<size_t, BoardSquare> overlay_;
+
+    /// Occupants of the overlay squares (TEMPLATE mode only).
+    OccupantPool overlayPool_;
+
+    /**
+     * @brief Modified occupancy bitmaps (TEMPLATE mode only).
+     *
+     * overlayOccupancy_[cy * chunksX_ + cx] → OccupancyBlock, copied from the
+     * template the first time a square of that chunk changes.
+     */
+    std::unordered_map<size_t, OccupancyBlock> overlayOccupancy_;
+
+    /// Receives the combat events of playerAttack(); not owned.
+    CombatEventSink *combatSink_ = &ConsoleCombatSink::instance();
+
+    /**
+     * @brief Checks whether the coordinate (x, y) lies inside the board.
+     *
+     * @return true if valid, false if out of bounds.
+     *
+     * PSEUDOCODE:
+     * return (0 <= x < width_) AND (0 <= y < height_)
+     */
+    bool inBounds(int x, int y) const;
+
+    /**
+     * @brief Returns the square at (x, y).
+     *
+     * PSEUDOCODE:
+     * if DENSE:    return squares_.at(x, y)
+     * if CHUNKED:  return chunkAt(x / CHUNK_SIZE, y / CHUNK_SIZE).squares[local index]
+     * if TEMPLATE: copy the template record into overlay_ if absent; return the overlay square
+     *
+     * @note The coordinate must be in bounds. In CHUNKED mode the containing
+     *       chunk is generated on first access.
+     */
+    BoardSquare &squareAt(int x, int y);
+
+    /**
+     * @brief Returns the square at (x, y) if it exists as a BoardSquare.
+     *
+     * @return The square, or nullptr for TEMPLATE squares that are not in the
+     *         overlay (read those with recordAt()).
+     *
+     * @note The coordinate must be in bounds. In CHUNKED mode the containing
+     *       chunk is generated on first access.
+     */
+    const BoardSquare *findSquare(int x, int y) const;
+
+    /**
+     * @brief Returns the pool holding the occupant of square (x, y).
+     *
+     * PSEUDOCODE:
+     * if DENSE:    return pools_[chunk index of (x, y)]
+     * if CHUNKED:  return chunkAt(x / CHUNK_SIZE, y / CHUNK_SIZE).pool
+     * if TEMPLATE: return overlayPool_
+     *
+     * @note The coordinate must be in bounds.
+     */
+    OccupantPool &poolAt(int x, int y);
+
+    /// @copydoc poolAt(int, int)
+    const OccupantPool &poolAt(int x, int y) const;
+
+    /**
+     * @brief Returns the chunk at chunk coordinates (cx, cy), generating it if needed.
+     *
+     * @param cx Chunk column.
+     * @param cy Chunk row.
+     * @return Reference to the (now populated) chunk.
+     */
+    Chunk &chunkAt(int cx, int cy) const;
+
+    /// @return Map key for chunk coordinates (cx, cy).
+    static std::uint64_t chunkKey(int cx, int cy);
+
+    /**
+     * @brief Returns the occupancy bitmaps of chunk (cx, cy) without generating it.
+     * @return Pointer to the block, or nullptr if the chunk is not generated yet.
+     */
+    const OccupancyBlock *findOccupancy(int cx, int cy) const;
+
+    /**
+     * @brief Returns the occupancy bitmaps of chunk (cx, cy), generating it if needed.
+     *
+     * In TEMPLATE mode the template's block is copied into overlayOccupancy_ first.
+     */
+    OccupancyBlock &occupancyAt(int cx, int cy);
+
+    /// @copydoc occupancyAt(int, int)
+    const OccupancyBlock &occupancyAt(int cx, int cy) const;
+
+    /**
+     * @brief Re-reads square (x, y) and updates its enemy/item bits.
+     *
+     * Called after every placeEnemy/placeItem/takeEnemy/takeItem/dropItem
+     * so the bitmaps never drift from the squares.
+     */
+    void syncOccupancy(int x, int y);
+
+    /**
+     * @brief Reads one occupancy bit, so actions on an empty square touch no squares.
+     * @return true if square (x, y) holds the given kind of occupant.
+     */
+    bool holds(OccupantKind kind, int x, int y) const;
+
+    /**
+     * @brief Manhattan distance from (x, y) to the nearest square of chunk (cx, cy).
+     */
+    static int distanceToChunk(int x, int y, int cx, int cy);
+
+    /**
+     * @brief Appends the occupants of one chunk that lie within maxDistance of (x, y).
+     *
+     * @param block Bitmaps of chunk (cx, cy).
+     * @param kind ENEMY or ITEM.
+     * @param cx Chunk column.
+     * @param cy Chunk row.
+     * @param x Origin column.
+     * @param y Origin row.
+     * @param maxDistance Largest Manhattan distance to report.
+     * @param out Hits are appended here.
+     */
+    static void collectChunkHits(const OccupancyBlock &block, OccupantKind kind, int cx, int cy,
+                                 int x, int y, int maxDistance, std::vector<SquareHit> &out);
+
+    /// Content codes drawn for each square by populateChunk(); all equally likely.
+    static constexpr int CONTENT_ENEMY = 0;
+    static constexpr int CONTENT_ITEM = 1;
+    static constexpr int CONTENT_EMPTY = 2;
+
+    /**
+     * @brief Populates every in-bounds square of chunk (cx, cy).
+     *
+     * Draws from a stream seeded with Utility::deriveSeed(seed_, cx, cy), so the
+     * result depends only on the world seed and the chunk coordinates.
+     *
+     * PSEUDOCODE:
+     * 1. Draw a content code for every square in one batch.
+     * 2. Construct all the chunk's enemies in one batch (OccupantPool::generateEnemies).
+     * 3. Pick all its items in one batch (ItemFactory::generate).
+     * 4. Walk the squares row by row, handing out enemies and items in order.
+     *
+     * @tparam LocalSquare Callable (int lx, int ly) → BoardSquare&, mapping
+     *         local chunk coordinates to storage.
+     * @param cx Chunk column.
+     * @param cy Chunk row.
+     * @param localSquare Returns the square at local coordinates (lx, ly).
+     * @param occupancy Bitmaps of the chunk, updated as squares are filled.
+     * @param pool Pool of the chunk; receives the new occupants.
+     */
+    template <typename LocalSquare>
+    void populateChunk(int cx, int cy, LocalSquare &&localSquare, OccupancyBlock &occupancy,
+                       OccupantPool &pool) const;
+};
+
+#endif // BOARD_H
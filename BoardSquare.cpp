@@ -1,108 +1,280 @@
-#include "BoardSquare.h"
-#include "Item.h"
-#include "Enemy.h"
-#include <sstream>
-
-/**
- * @file BoardSquare.cpp
- * @brief Implements BoardSquare class, representing a single square on the board.
- *
- * Each square may contain an Item or an Enemy. Provides functions to inspect,
- * place, take, or drop contents.
- */
-
-/**
- * @brief Constructs an empty BoardSquare with no item or enemy.
- */
-BoardSquare::BoardSquare()
-    : item_(nullptr), enemy_(nullptr)
-{}
-
-/**
- * @brief Returns a textual description of the square's contents.
- * @return A string describing an enemy, an item, or that the square is empty.
- */
-std::string BoardSquare::look() const
-{
-    std::ostringstream ss;
-    if (enemy_) {
-        ss << "An enemy is here: " << enemy_->getName()
-        << " (H:" << enemy_->getHealth() << " A:" << enemy_->getAttack()
-        << " D:" << enemy_->getDefence() << ")";
-    } else if (item_) {
-        ss << "You see an item: " << item_->getName()
-        << " (weight " << item_->getWeight() << ")";
-    } else {
-        ss << "The square is empty.";
-    }
-    return ss.str();
-}
-
-/**
- * @brief Places an item on the square.
- * @param item Unique pointer to the Item to place.
- */
-void BoardSquare::placeItem(std::unique_ptr<Item> item) {
-    item_ = std::move(item);
-}
-
-/**
- * @brief Places an enemy on the square.
- * @param enemy Unique pointer to the Enemy to place.
- */
-void BoardSquare::placeEnemy(std::unique_ptr<Enemy> enemy) {
-    enemy_ = std::move(enemy);
-}
-
-/**
- * @brief Returns a raw pointer to the item on the square.
- * @return Pointer to Item, or nullptr if none.
- */
-Item* BoardSquare::getItem() const { return item_.get(); }
-
-/**
- * @brief Returns a raw pointer to the enemy on the square.
- * @return Pointer to Enemy, or nullptr if none.
- */
-Enemy* BoardSquare::getEnemy() const { return enemy_.get(); }
-
-/**
- * @brief Removes and returns the item from the square.
- * @return Unique pointer to the removed Item.
- */
-std::unique_ptr<Item> BoardSquare::takeItem() {
-    return std::move(item_);
-}
-
-/**
- * @brief Removes and returns the enemy from the square.
- * @return Unique pointer to the removed Enemy.
- */
-std::unique_ptr<Enemy> BoardSquare::takeEnemy() {
-    return std::move(enemy_);
-}
-
-/**
- * @brief Attempts to drop an item onto the square.
- * @param itemToDrop Unique pointer to the Item to drop.
- * @return True if the item was placed successfully, false if the square already contains an item or the pointer is null.
- */
-bool BoardSquare::dropItem(std::unique_ptr<Item> itemToDrop)
-{
-    if (!itemToDrop) return false;
-    if (item_) return false;
-    item_ = std::move(itemToDrop);
-    return true;
-}
-
-/**
- * @brief Checks if an enemy is present on the square.
- * @return True if an enemy exists, false otherwise.
- */
-bool BoardSquare::hasEnemy() const { return enemy_ != nullptr; }
-
-/**
- * @brief Checks if an item is present on the square.
- * @return True if an item exists, false otherwise.
- */
-bool BoardSquare::hasItem() const { return item_ != nullptr; }
+#include "BoardSquare.h"
+#include "Item.h"
+#include "ItemFactory.h"
+#include "Enemy.h"
+#include "Constants.h"
+#include "Utility.h"
+#include "OccupantPool.h"
+#include <algorithm>
+#include <charconv>
+#include <string_view>
+
+/**
+ * @file BoardSquare.cpp
+ * @brief Implements BoardSquare class, representing a single square on the board.
+ *
+ * Each square may contain an Item or an Enemy. Provides functions to inspect,
+ * place, take, or drop contents. The occupants themselves live in the
+ * OccupantPool passed to each call; the square only stores a tagged id.
+ */
+
+/**
+ * @brief Constructs an empty BoardSquare with no item or enemy.
+ */
+BoardSquare::BoardSquare()
+    : bits_(EMPTY_TAG)
+{}
+
+namespace {
+
+/**
+ * @brief Appends text and integers to a fixed buffer without allocating.
+ *
+ * Output that does not fit is dropped; the buffer is kept NUL-terminated.
+ */
+class LineWriter {
+public:
+    LineWriter(char *buffer, size_t size) : buffer_(buffer), size_(size) {
+        if (size_ > 0) buffer_[0] = '\0';
+    }
+
+    LineWriter &operator<<(std::string_view text) {
+        if (size_ == 0) return *this;
+        const size_t n = std::min(text.size(), size_ - 1 - length_);
+        text.copy(buffer_ + length_, n);
+        length_ += n;
+        buffer_[length_] = '\0';
+        return *this;
+    }
+
+    LineWriter &operator<<(int value) {
+        char digits[16];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        return *this << std::string_view(digits, static_cast<size_t>(result.ptr - digits));
+    }
+
+    size_t length() const { return length_; }
+
+private:
+    char *buffer_;
+    size_t size_;
+    size_t length_ = 0;
+};
+
+/// Formats the enemy line shared by live squares and stored records.
+size_t describeEnemy(LineWriter &out, int raceCode, int health, int attack, int defence)
+{
+    const std::string_view name = raceCode >= 0 ? Constants::ENEMY_NAMES[raceCode] : std::string_view("Unknown (Enemy)");
+    out << "An enemy is here: " << name << " (H:" << health << " A:" << attack << " D:" << defence << ")";
+    return out.length();
+}
+
+/// Formats the item line shared by live squares and stored records.
+size_t describeItem(LineWriter &out, std::string_view name, int weight)
+{
+    out << "You see an item: " << name << " (weight " << weight << ")";
+    return out.length();
+}
+
+/// Formats the empty-square line.
+size_t describeEmpty(LineWriter &out)
+{
+    out << "The square is empty.";
+    return out.length();
+}
+
+} // namespace
+
+/**
+ * @brief Returns a textual description of the square's contents.
+ * @param pool Pool holding this square's occupant.
+ * @return A string describing an enemy, an item, or that the square is empty.
+ */
+std::string BoardSquare::look(const OccupantPool &pool) const
+{
+    char line[LOOK_BUFFER_SIZE];
+    return std::string(line, look(pool, line, sizeof(line)));
+}
+
+/**
+ * @brief Formats the square's description into a caller buffer without allocating.
+ * @param pool Pool holding this square's occupant.
+ * @param buffer Destination.
+ * @param size Capacity of buffer.
+ * @return Characters written, excluding the terminating NUL.
+ */
+size_t BoardSquare::look(const OccupantPool &pool, char *buffer, size_t size) const
+{
+    LineWriter out(buffer, size);
+    if (const Enemy *enemy = getEnemy(pool)) {
+        return describeEnemy(out, static_cast<int>(enemy->getRaceId()), enemy->getHealth(),
+                             enemy->getAttack(), enemy->getDefence());
+    }
+    if (const Item *item = getItem()) {
+        return describeItem(out, item->getName(), item->getWeight());
+    }
+    return describeEmpty(out);
+}
+
+/**
+ * @brief Formats a stored record's description into a caller buffer without allocating.
+ * @param record Record to describe.
+ * @param buffer Destination.
+ * @param size Capacity of buffer.
+ * @return Characters written, excluding the terminating NUL.
+ */
+size_t BoardSquare::look(const SquareRecord &record, char *buffer, size_t size)
+{
+    LineWriter out(buffer, size);
+    if (record.kind == SquareRecord::ENEMY && record.code < Constants::RACE_COUNT) {
+        const Constants::RaceStats &stats = Constants::raceStats(record.code, Utility::isNight());
+        return describeEnemy(out, record.code, record.health, stats.attack, stats.defence);
+    }
+    if (record.kind == SquareRecord::ITEM) {
+        return describeItem(out, ItemFactory::nameOf(record.code), ItemFactory::weightOf(record.code));
+    }
+    return describeEmpty(out);
+}
+
+/**
+ * @brief Places an item on the square by recording its catalogue kind.
+ * @param item Catalogue item to place.
+ */
+void BoardSquare::placeItem(const Item *item) {
+    const int kind = item ? ItemFactory::kindOf(*item) : -1;
+    if (kind < 0) return;
+    bits_ = (ITEM_TAG << ID_BITS) | static_cast<std::uint32_t>(kind);
+}
+
+/**
+ * @brief Spawns an enemy on the square, constructing it inside the pool.
+ * @param pool Pool that owns the enemy.
+ * @param raceCode Race code of the enemy.
+ * @return The new enemy, or nullptr if the race code is invalid.
+ */
+Enemy *BoardSquare::placeEnemy(OccupantPool &pool, int raceCode) {
+    if (raceCode < 0 || raceCode >= Constants::RACE_COUNT) return nullptr;
+    const std::uint32_t slot = pool.addEnemy(raceCode);
+    attachEnemy(slot);
+    return pool.enemy(slot);
+}
+
+/**
+ * @brief Returns the catalogue item on the square.
+ * @return Pointer to Item, or nullptr if none.
+ */
+const Item* BoardSquare::getItem() const {
+    return hasItem() ? ItemFactory::item(static_cast<int>(id())) : nullptr;
+}
+
+/**
+ * @brief Returns a raw pointer to the enemy on the square.
+ * @param pool Pool holding this square's occupant.
+ * @return Pointer to Enemy, or nullptr if none.
+ */
+Enemy* BoardSquare::getEnemy(OccupantPool &pool) const {
+    return hasEnemy() ? pool.enemy(id()) : nullptr;
+}
+
+/**
+ * @brief Returns a read-only pointer to the enemy on the square.
+ * @param pool Pool holding this square's occupant.
+ * @return Pointer to Enemy, or nullptr if none.
+ */
+const Enemy* BoardSquare::getEnemy(const OccupantPool &pool) const {
+    return hasEnemy() ? pool.enemy(id()) : nullptr;
+}
+
+/**
+ * @brief Returns a generational handle to the enemy on the square.
+ * @param pool Pool holding this square's occupant.
+ * @return Handle, or a null handle if none.
+ */
+EnemyHandle BoardSquare::enemyHandle(const OccupantPool &pool) const {
+    return hasEnemy() ? pool.handleOf(id()) : EnemyHandle();
+}
+
+/**
+ * @brief Removes and returns the item from the square.
+ * @return The removed catalogue item, or nullptr if there was none.
+ */
+const Item *BoardSquare::takeItem() {
+    const Item *item = getItem();
+    if (item) bits_ = EMPTY_TAG;
+    return item;
+}
+
+/**
+ * @brief Removes the enemy from the square and destroys it.
+ * @param pool Pool holding this square's occupant.
+ * @return True if there was an enemy to remove.
+ */
+bool BoardSquare::takeEnemy(OccupantPool &pool) {
+    if (!hasEnemy()) return false;
+    const std::uint32_t slot = id();
+    bits_ = EMPTY_TAG;
+    pool.releaseEnemy(slot);
+    return true;
+}
+
+/**
+ * @brief Attempts to drop an item onto the square.
+ * @param itemToDrop Catalogue item to drop.
+ * @return True if the item was placed, false if the square is occupied or the pointer is null.
+ */
+bool BoardSquare::dropItem(const Item *itemToDrop)
+{
+    if (!itemToDrop) return false;
+    if (bits_ != EMPTY_TAG) return false;
+    placeItem(itemToDrop);
+    return true;
+}
+
+/**
+ * @brief Describes the square's occupant as a fixed-size record.
+ * @param pool Pool holding this square's occupant.
+ * @return Record with the enemy's race code and health, the item's kind, or EMPTY.
+ */
+SquareRecord BoardSquare::toRecord(const OccupantPool &pool) const
+{
+    SquareRecord record;
+    if (const Enemy *enemy = getEnemy(pool)) {
+        record.kind = SquareRecord::ENEMY;
+        record.code = static_cast<std::uint8_t>(static_cast<int>(enemy->getRaceId()));
+        record.health = static_cast<std::int16_t>(enemy->getHealth());
+    } else if (hasItem()) {
+        record.kind = SquareRecord::ITEM;
+        record.code = static_cast<std::uint8_t>(id());
+    }
+    return record;
+}
+
+/**
+ * @brief Rebuilds the square's occupant from a record.
+ * @param pool Pool that owns this square's occupants.
+ * @param record Record to restore.
+ * @return True on success, false if the record is invalid.
+ */
+bool BoardSquare::restore(OccupantPool &pool, const SquareRecord &record)
+{
+    takeItem();
+    takeEnemy(pool);
+    switch (record.kind) {
+    case SquareRecord::EMPTY:
+        return true;
+    case SquareRecord::ENEMY: {
+        Enemy *enemy = placeEnemy(pool, record.code);
+        if (!enemy) return false;
+        // Time-of-day stats first, so the saved health is not shifted by them
+        enemy->updateForTime(Utility::isNight());
+        enemy->setHealth(record.health);
+        return true;
+    }
+    case SquareRecord::ITEM:
+        // The record already holds the kind code this square stores
+        if (record.code >= ItemFactory::ITEM_KIND_COUNT) return false;
+        bits_ = (ITEM_TAG << ID_BITS) | record.code;
+        return true;
+    }
+    return false;
+}
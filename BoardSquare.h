@@ -1,159 +1,286 @@
-/**
- * @file BoardSquare.h
- * @brief Declares the BoardSquare class, representing a single cell on the game board.
- *
- * A BoardSquare may contain either:
- *  - one Item
- *  - one Enemy
- *  - or nothing
- *
- * The square owns its contents exclusively using std::unique_ptr.
- * This ensures BoardSquare controls the lifetime of objects placed on it.
- */
-
-#ifndef BOARDSQUARE_H
-#define BOARDSQUARE_H
-
-#include <memory>
-#include <string>
-#include "Enemy.h"
-
-class Item;
-class Enemy;
-
-/**
- * @class BoardSquare
- * @brief Represents one cell on the game board (may hold an Item or an Enemy).
- *
- * Responsibilities:
- *  - Store exactly one occupant: either an Item *or* an Enemy (never both).
- *  - Provide methods to look at, place, or remove contents.
- *  - Return raw pointers for inspection, but maintain ownership internally
- *    via std::unique_ptr.
- *
- * @note Game rules enforce that a BoardSquare cannot contain both an item
- *       and an enemy at the same time.
- */
-class BoardSquare {
-public:
-    /**
-     * @brief Constructs an empty BoardSquare.
-     *
-     * item_  = nullptr
-     * enemy_ = nullptr
-     */
-    BoardSquare();
-
-    ~BoardSquare() = default;
-
-    /**
-     * @brief Returns a text description of the square's contents.
-     *
-     * PSEUDOCODE:
-     * 1. If enemy_ != nullptr → return "Enemy: <enemy-name>"
-     * 2. Else if item_ != nullptr → return "Item: <item-name>"
-     * 3. Else return "Empty"
-     *
-     * @return std::string describing what the square contains.
-     */
-    std::string look() const;
-
-    /**
-     * @brief Places an Item into the square.
-     *
-     * PSEUDOCODE:
-     * 1. If enemy_ exists → cannot place item (but actual check is enforced externally).
-     * 2. item_ = move(item)
-     *
-     * @param item Unique pointer to an Item (ownership transferred).
-     */
-    void placeItem(std::unique_ptr<Item> item);
-
-    /**
-     * @brief Places an Enemy into the square.
-     *
-     * PSEUDOCODE:
-     * 1. If item_ exists → cannot place enemy (external logic ensures this).
-     * 2. enemy_ = move(enemy)
-     *
-     * @param enemy Unique pointer to an Enemy (ownership transferred).
-     */
-    void placeEnemy(std::unique_ptr<Enemy> enemy);
-
-    /**
-     * @brief Returns a raw pointer to the Item (if any).
-     *
-     * @return Pointer to Item, or nullptr if no item present.
-     *
-     * @warning This does *not* transfer ownership. Only for inspection.
-     */
-    Item* getItem() const;
-
-    /**
-     * @brief Returns a raw pointer to the Enemy (if any).
-     *
-     * @return Pointer to Enemy, or nullptr if no enemy present.
-     *
-     * @note Ownership is still retained by the BoardSquare.
-     */
-    Enemy* getEnemy() const;
-
-    /**
-     * @brief Removes and returns the Item from the square.
-     *
-     * PSEUDOCODE:
-     * 1. tmp = move(item_)
-     * 2. item_ = nullptr
-     * 3. return tmp
-     *
-     * @return unique_ptr<Item> (ownership transferred out).
-     */
-    std::unique_ptr<Item> takeItem();
-
-    /**
-     * @brief Removes and returns the Enemy from the square.
-     *
-     * PSEUDOCODE:
-     * 1. tmp = move(enemy_)
-     * 2. enemy_ = nullptr
-     * 3. return tmp
-     *
-     * @return unique_ptr<Enemy> (ownership transferred out).
-     */
-    std::unique_ptr<Enemy> takeEnemy();
-
-    /**
-     * @brief Attempts to drop an Item into the square.
-     *
-     * @param itemToDrop unique_ptr<Item> representing the item to place.
-     * @return true if drop succeeded, false otherwise.
-     *
-     * PSEUDOCODE:
-     * 1. If item_ != nullptr or enemy_ != nullptr → return false.
-     * 2. item_ = move(itemToDrop)
-     * 3. return true
-     *
-     * @note Only one occupant allowed at a time.
-     */
-    bool dropItem(std::unique_ptr<Item> itemToDrop);
-
-    /**
-     * @brief Checks whether the square currently holds an enemy.
-     *
-     * @return true if enemy_ != nullptr.
-     */
-    bool hasEnemy() const;
-
-    /**
-     * @brief Checks whether the square currently holds an item.
-     *
-     * @return true if item_ != nullptr.
-     */
-    bool hasItem() const;
-
-private:
-    std::unique_ptr<Item> item_;   ///< Item contained in this square (if any).
-    std::unique_ptr<Enemy> enemy_; ///< Enemy contained in this square (if any).
-};
-
-#endif // BOARDSQUARE_H
+/**
+ * @file BoardSquare.h
+ * @brief Declares the BoardSquare class, representing a single cell on the game board.
+ *
+ * A BoardSquare may contain either:
+ *  - one Item
+ *  - one Enemy
+ *  - or nothing
+ *
+ * The square is a single 32-bit tagged handle: a 2-bit tag (empty, enemy or
+ * item) and a 30-bit id. An enemy id indexes the OccupantPool that owns the
+ * Enemy; the Board owns the pools, so methods that reach an enemy take the
+ * pool of the square's chunk. An item id is the item's kind code in the
+ * shared ItemFactory catalogue, so items need no storage at all.
+ */
+
+#ifndef BOARDSQUARE_H
+#define BOARDSQUARE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "OccupantPool.h"
+
+class Item;
+
+/**
+ * @struct SquareRecord
+ * @brief Pointer-free, fixed-size (4 byte) description of a square's contents.
+ *
+ * Used by the binary save format and world templates: a board is written as
+ * a flat array of these.
+ *
+ * Fields:
+ *  - kind:   EMPTY, ENEMY or ITEM
+ *  - code:   race code (Constants::RACE_NAMES index) or item kind (ItemFactory)
+ *  - health: current enemy health (0 for items and empty squares)
+ */
+struct SquareRecord {
+    static constexpr std::uint8_t EMPTY = 0;
+    static constexpr std::uint8_t ENEMY = 1;
+    static constexpr std::uint8_t ITEM  = 2;
+
+    std::uint8_t kind = EMPTY;
+    std::uint8_t code = 0;
+    std::int16_t health = 0;
+};
+
+/**
+ * @class BoardSquare
+ * @brief Represents one cell on the game board (may hold an Item or an Enemy).
+ *
+ * Responsibilities:
+ *  - Record exactly one occupant: either an Item *or* an Enemy (never both).
+ *  - Provide methods to look at, place, or remove contents.
+ *  - Return raw pointers for inspection; ownership stays with the pool
+ *    (enemies) or the catalogue (items).
+ *
+ * Layout (4 bytes):
+ *  bits 31..30 – tag: EMPTY, ENEMY or ITEM
+ *  bits 29..0  – enemy slot in the pool, or item kind code (0 when EMPTY)
+ *
+ * @note Game rules enforce that a BoardSquare cannot contain both an item
+ *       and an enemy at the same time; the representation cannot express it.
+ */
+class BoardSquare {
+public:
+    /**
+     * @brief Constructs an empty BoardSquare.
+     */
+    BoardSquare();
+
+    ~BoardSquare() = default;
+
+    /// Squares are move-only so a handle is never accidentally shared by two squares.
+    BoardSquare(BoardSquare &&) = default;
+    BoardSquare &operator=(BoardSquare &&) = default;
+
+    /**
+     * @brief Returns a text description of the square's contents.
+     *
+     * PSEUDOCODE:
+     * 1. If tag is ENEMY → return "Enemy: <enemy-name>"
+     * 2. Else if tag is ITEM → return "Item: <item-name>"
+     * 3. Else return "Empty"
+     *
+     * @param pool Pool holding this square's occupant.
+     * @return std::string describing what the square contains.
+     */
+    std::string look(const OccupantPool &pool) const;
+
+    /// Buffer size that always holds a complete look() line.
+    static constexpr size_t LOOK_BUFFER_SIZE = 96;
+
+    /**
+     * @brief Writes the look() description into a caller-supplied buffer.
+     *
+     * Names come from interned tables and numbers are formatted in place, so
+     * no heap memory is allocated. The text is truncated to fit and is always
+     * NUL-terminated when size > 0.
+     *
+     * @param pool Pool holding this square's occupant.
+     * @param buffer Destination (LOOK_BUFFER_SIZE characters is always enough).
+     * @param size Capacity of buffer, including the terminating NUL.
+     * @return Number of characters written, excluding the NUL.
+     */
+    size_t look(const OccupantPool &pool, char *buffer, size_t size) const;
+
+    /**
+     * @brief Writes the look() description of a stored record into a buffer.
+     *
+     * Used for squares that exist only as records (e.g. untouched template
+     * squares): enemy stats are taken from the race table for the current
+     * time of day, so no Enemy or Item is created.
+     *
+     * @param record Record to describe.
+     * @param buffer Destination.
+     * @param size Capacity of buffer, including the terminating NUL.
+     * @return Number of characters written, excluding the NUL.
+     */
+    static size_t look(const SquareRecord &record, char *buffer, size_t size);
+
+    /**
+     * @brief Places an Item into the square.
+     *
+     * @param item Catalogue item (see ItemFactory).
+     *
+     * @pre The square is empty (enforced by the Board). A null item leaves
+     *      the square unchanged.
+     */
+    void placeItem(const Item *item);
+
+    /**
+     * @brief Spawns a new Enemy into the square.
+     *
+     * The enemy is constructed directly in the pool; nothing is allocated
+     * per enemy.
+     *
+     * @param pool Pool that will own the enemy.
+     * @param raceCode Index into Constants::RACE_NAMES.
+     * @return The new enemy (owned by the pool), or nullptr if raceCode is
+     *         out of range, in which case the square is unchanged.
+     *
+     * @pre The square is empty (enforced by the Board).
+     */
+    Enemy *placeEnemy(OccupantPool &pool, int raceCode);
+
+    /**
+     * @brief Puts an enemy already constructed in the pool onto the square.
+     *
+     * Used with OccupantPool::generateEnemies(), which constructs a batch of
+     * enemies before they are spread over their squares.
+     *
+     * @param slot Slot id of the enemy in this square's pool.
+     *
+     * @pre The square is empty (enforced by the Board).
+     */
+    void attachEnemy(std::uint32_t slot) { bits_ = (ENEMY_TAG << ID_BITS) | slot; }
+
+    /**
+     * @brief Returns the Item on the square (if any).
+     *
+     * @return The catalogue item, or nullptr if no item present.
+     */
+    const Item* getItem() const;
+
+    /**
+     * @brief Returns a raw pointer to the Enemy (if any).
+     *
+     * @param pool Pool holding this square's occupant.
+     * @return Pointer to Enemy, or nullptr if no enemy present.
+     *
+     * @note Ownership is still retained by the pool. The pointer is only
+     *       valid until the enemy is taken; use enemyHandle() to keep a
+     *       reference.
+     */
+    Enemy* getEnemy(OccupantPool &pool) const;
+
+    /// @copydoc getEnemy(OccupantPool &) const
+    const Enemy* getEnemy(const OccupantPool &pool) const;
+
+    /**
+     * @brief Returns a generational handle to the Enemy (if any).
+     *
+     * Unlike the pointer from getEnemy(), the handle can be kept: resolving
+     * it after the enemy is destroyed yields nullptr.
+     *
+     * @param pool Pool holding this square's occupant.
+     * @return Handle to the enemy, or a null handle if no enemy present.
+     */
+    EnemyHandle enemyHandle(const OccupantPool &pool) const;
+
+    /**
+     * @brief Removes and returns the Item from the square.
+     *
+     * PSEUDOCODE:
+     * 1. If tag is not ITEM → return nullptr
+     * 2. tmp = catalogue item of id
+     * 3. tag = EMPTY
+     * 4. return tmp
+     *
+     * @return The catalogue item that was on the square, or nullptr.
+     */
+    const Item *takeItem();
+
+    /**
+     * @brief Removes the Enemy from the square and destroys it.
+     *
+     * PSEUDOCODE:
+     * 1. If tag is not ENEMY → return false
+     * 2. pool.releaseEnemy(id)
+     * 3. tag = EMPTY
+     * 4. return true
+     *
+     * @param pool Pool holding this square's occupant.
+     * @return true if an enemy was removed.
+     *
+     * @warning Pointers previously obtained from getEnemy() dangle afterwards;
+     *          read anything still needed (e.g. the kill reward) first.
+     */
+    bool takeEnemy(OccupantPool &pool);
+
+    /**
+     * @brief Attempts to drop an Item into the square.
+     *
+     * @param itemToDrop Catalogue item to place.
+     * @return true if drop succeeded, false otherwise.
+     *
+     * PSEUDOCODE:
+     * 1. If itemToDrop is null or the square is not empty → return false.
+     * 2. placeItem(itemToDrop)
+     * 3. return true
+     *
+     * @note Only one occupant allowed at a time.
+     */
+    bool dropItem(const Item *itemToDrop);
+
+    /**
+     * @brief Checks whether the square currently holds an enemy.
+     *
+     * @return true if the tag is ENEMY.
+     */
+    bool hasEnemy() const { return (bits_ >> ID_BITS) == ENEMY_TAG; }
+
+    /**
+     * @brief Checks whether the square currently holds an item.
+     *
+     * @return true if the tag is ITEM.
+     */
+    bool hasItem() const { return (bits_ >> ID_BITS) == ITEM_TAG; }
+
+    /**
+     * @brief Describes the square's contents as a pointer-free record.
+     * @param pool Pool holding this square's occupant.
+     * @return EMPTY, ENEMY(race code, health) or ITEM(kind code).
+     */
+    SquareRecord toRecord(const OccupantPool &pool) const;
+
+    /**
+     * @brief Replaces the square's contents with the occupant a record describes.
+     *
+     * Any current occupant is released from the pool and destroyed first.
+     *
+     * @param pool Pool that owns this square's occupants.
+     * @param record Record previously produced by toRecord().
+     * @return false if the record holds an unknown kind, race or item code.
+     */
+    bool restore(OccupantPool &pool, const SquareRecord &record);
+
+private:
+    static constexpr int ID_BITS = 30;                               ///< Width of the id field.
+    static constexpr std::uint32_t ID_MASK = (1u << ID_BITS) - 1;    ///< Selects the id field.
+    static constexpr std::uint32_t EMPTY_TAG = 0;                    ///< Tag of an empty square.
+    static constexpr std::uint32_t ENEMY_TAG = 1;                    ///< Tag of an enemy square.
+    static constexpr std::uint32_t ITEM_TAG = 2;                     ///< Tag of an item square.
+
+    /// @return The occupant id stored in the handle.
+    std::uint32_t id() const { return bits_ & ID_MASK; }
+
+    std::uint32_t bits_; ///< Tag in the top two bits, pool id below.
+};
+
+static_assert(sizeof(BoardSquare) == 4, "a square must stay a 4-byte handle");
+
+#endif // BOARDSQUARE_H
@@ -1,169 +1,363 @@
-#include "Character.h"
-#include "Utility.h"
-#include <iostream>
-
-/**
- * @file Character.cpp
- * @brief Implements the Character class, including attacks, defence, and inventory management.
- *
- * Responsibilities:
- *  - Execute attacks and handle defence success.
- *  - Manage inventory with item effects.
- *  - Track health, attack, defence, and strength stats.
- */
-
-/**
- * @brief Constructs a Character with specified stats.
- *
- * @param raceName Name of the character's race.
- * @param attack Base attack value.
- * @param attackChance Probability of a successful attack.
- * @param defence Base defence value.
- * @param defenceChance Probability of a successful defence.
- * @param health Starting health.
- * @param strength Maximum carry strength.
- */
-Character::Character(const std::string &raceName,
-                     int attack, double attackChance,
-                     int defence, double defenceChance,
-                     int health, int strength)
-    : race_(raceName),
-    baseAttack_(attack), baseDefence_(defence), baseHealth_(health), baseStrength_(strength),
-    attack_(attack), defence_(defence), health_(health), strength_(strength),
-    attackChance_(attackChance), defenceChance_(defenceChance)
-{
-}
-
-/**
- * @brief Determines if an attack is successful based on attackChance_.
- * @return True if the attack succeeds, false otherwise.
- */
-bool Character::attackSuccess() const {
-    return Utility::probability(attackChance_);
-}
-
-/**
- * @brief Determines if a defence is successful based on defenceChance_.
- * @return True if the defence succeeds, false otherwise.
- */
-bool Character::defenceSuccess() const {
-    return Utility::probability(defenceChance_);
-}
-
-/**
- * @brief Executes an attack on a target Character.
- *
- * Handles attack success, defence success, normal and special damage,
- * and prints combat messages.
- *
- * @param target Pointer to the target Character. Must be non-null and alive.
- */
-void Character::attack(Character *target)
-{
-    if (!target) {
-        std::cout << "No target to attack.\n";
-        return;
-    }
-    if (!target->isAlive()) {
-        std::cout << target->getName() << " is already defeated.\n";
-        return;
-    }
-    std::cout << getName() << " attacks " << target->getName() << "!\n";
-
-    if (!attackSuccess()) {
-        std::cout << getName() << " missed the attack.\n";
-        return;
-    }
-
-    if (target->defenceSuccess()) {
-        int specialDamage = target->handleSuccessfulDefence();
-        if (specialDamage > 0) {
-            target->modifyHealth(-specialDamage);
-        }
-        std::cout << target->getName() << " successfully defended (special). Damage taken: "
-                  << specialDamage << "\n";
-        return;
-    }
-
-    int damage = attack_ - target->defence_;
-    if (damage < 0) damage = 0;
-    target->modifyHealth(-damage);
-
-    std::cout << getName() << " deals " << damage << " damage to " << target->getName() << ".\n";
-}
-
-/**
- * @brief Attempts to pick up an item and add it to inventory.
- *
- * Applies the item's effects if picked up successfully. Respects weight and category constraints.
- *
- * @param item Unique pointer to the Item to pick up.
- * @return True if pickup succeeded, false otherwise.
- */
-bool Character::pickUp(std::unique_ptr<Item> item)
-{
-    if (!item) return false;
-
-    int w = item->getWeight();
-    ItemType t = item->getType();
-    if (t != ItemType::RING) {
-        for (const auto &it : inventory_) {
-            if (it->getType() == t) return false;
-        }
-    }
-
-    if (carriedWeight_ + w > strength_) {
-        return false;
-    }
-
-    item->applyEffect(*this);
-    carriedWeight_ += w;
-    inventory_.push_back(std::move(item));
-    return true;
-}
-
-/**
- * @brief Removes an item from the inventory by index.
- *
- * Reverses the item's effect and updates carried weight.
- *
- * @param index Index of the item to remove.
- * @return Unique pointer to the removed item, or nullptr if index invalid.
- */
-std::unique_ptr<Item> Character::removeItem(size_t index)
-{
-    if (index >= inventory_.size()) return nullptr;
-    std::unique_ptr<Item> taken = std::move(inventory_[index]);
-    taken->removeEffect(*this);
-    carriedWeight_ -= taken->getWeight();
-    if (carriedWeight_ < 0) carriedWeight_ = 0;
-    inventory_.erase(inventory_.begin() + index);
-    return taken;
-}
-
-/**
- * @brief Re-adds an item to inventory.
- *
- * Applies the item's effect and updates carried weight. Will not add if capacity exceeded.
- *
- * @param item Unique pointer to the Item to re-add.
- */
-void Character::addItemBack(std::unique_ptr<Item> item)
-{
-    if (!item) return;
-    if (carriedWeight_ + item->getWeight() > strength_) return;
-    item->applyEffect(*this);
-    carriedWeight_ += item->getWeight();
-    inventory_.push_back(std::move(item));
-}
-
-/**
- * @brief Prints the inventory contents and total weight carried.
- */
-void Character::printInventory() const
-{
-    std::cout << "Inventory (" << inventory_.size() << ") weight " << carriedWeight_ << "/" << strength_ << ":\n";
-    for (size_t i = 0; i < inventory_.size(); ++i) {
-        std::cout << " [" << i << "] " << inventory_[i]->getName() << " (w=" << inventory_[i]->getWeight() << ")\n";
-    }
-}
+#include "Character.h"
+#include "Utility.h"
+#include <iostream>
+
+/**
+ * @file Character.cpp
+ * @brief Implements the Character class, including attacks, defence, and inventory management.
+ *
+ * Responsibilities:
+ *  - Resolve attacks and defence success, reporting them to a combat sink.
+ *  - Manage inventory with item effects.
+ *  - Track health, attack, defence, and strength stats.
+ */
+
+/**
+ * @brief Constructs a Character with its race's daytime stats.
+ *
+ * @param race Race of the character; indexes the race tables.
+ */
+Character::Character(Constants::Race race)
+    : Character(race, Constants::raceStats(race, false))
+{
+}
+
+/**
+ * @brief Initialises every base and effective stat from one stat line.
+ *
+ * @param race Race of the character.
+ * @param stats Stat line of that race.
+ */
+Character::Character(Constants::Race race, const Constants::RaceStats &stats)
+    : race_(Constants::RACE_NAMES[static_cast<int>(race)]), raceId_(race),
+    baseAttack_(stats.attack), baseDefence_(stats.defence), baseHealth_(stats.health), baseStrength_(stats.strength),
+    attack_(stats.attack), defence_(stats.defence), health_(stats.health), strength_(stats.strength),
+    attackChance_(stats.attackChance), defenceChance_(stats.defenceChance)
+{
+}
+
+/**
+ * @brief Determines if an attack is successful based on attackChance_.
+ * @return True if the attack succeeds, false otherwise.
+ */
+bool Character::attackSuccess() const {
+    return Utility::probability(attackChance_);
+}
+
+/**
+ * @brief Determines if a defence is successful based on defenceChance_.
+ * @return True if the defence succeeds, false otherwise.
+ */
+bool Character::defenceSuccess() const {
+    return Utility::probability(defenceChance_);
+}
+
+/**
+ * @brief Resolves an attack on a target Character without printing anything.
+ *
+ * Handles attack success, defence success, normal and special damage.
+ *
+ * @param target Target Character.
+ * @return The outcome.
+ */
+CombatOutcome Character::resolveAttack(Character &target)
+{
+    CombatOutcome outcome;
+    if (!target.isAlive()) {
+        outcome.result = CombatResult::ALREADY_DEFEATED;
+        return outcome;
+    }
+    if (!attackSuccess()) {
+        outcome.result = CombatResult::MISSED;
+        return outcome;
+    }
+
+    if (target.defenceSuccess()) {
+        outcome.result = CombatResult::DEFENDED;
+        outcome.damage = target.handleSuccessfulDefence();
+    } else {
+        outcome.result = CombatResult::HIT;
+        outcome.damage = std::max(0, attack_ - target.defence_);
+    }
+    if (outcome.damage > 0) {
+        target.modifyHealth(-outcome.damage);
+    }
+    outcome.killed = !target.isAlive();
+    return outcome;
+}
+
+/**
+ * @brief Executes an attack on a target Character and reports it.
+ *
+ * @param target Pointer to the target Character.
+ * @param sink Receives one ATTACK event.
+ * @return The outcome.
+ */
+CombatOutcome Character::attack(Character *target, CombatEventSink &sink)
+{
+    CombatEvent event;
+    event.attacker = getName();
+    if (target) {
+        event.target = target->getName();
+        event.outcome = resolveAttack(*target);
+    }
+    sink.record(event);
+    return event.outcome;
+}
+
+/**
+ * @brief Applies the race's reaction to a successful defence.
+ *
+ * One table lookup by race code and time of day, then a switch.
+ *
+ * @return Damage the defender (this character) takes itself; resolveAttack() applies it
+ *         to the target. 0 for every reaction but RANDOM_DAMAGE and COUNTER.
+ */
+int Character::handleSuccessfulDefence()
+{
+    switch (Constants::defenceReaction(raceId_, Utility::isNight())) {
+    case Constants::DefenceReaction::NONE:
+        return 0;
+    case Constants::DefenceReaction::HEAL:
+        modifyHealth(+1);
+        return 0;
+    case Constants::DefenceReaction::RANDOM_DAMAGE:
+        return Utility::randInt(0, MAX_RANDOM_DEFENCE_DAMAGE);
+    case Constants::DefenceReaction::COUNTER:
+        return counterDamage();
+    }
+    return 0;
+}
+
+/**
+ * @brief Collects this character's combat numbers against an opponent.
+ * @param opponent The other side.
+ * @param night Time of day.
+ * @return The profile.
+ */
+Character::CombatProfile Character::combatProfile(const Character &opponent, bool night) const
+{
+    CombatProfile profile;
+    profile.attackChance = attackChance_;
+    profile.defenceChance = defenceChance_;
+    profile.health = health_;
+    profile.hitDamage = std::max(0, attack_ - opponent.defence_);
+    profile.reaction = Constants::defenceReaction(raceId_, night);
+    profile.counterDamage = profile.reaction == Constants::DefenceReaction::COUNTER ? counterDamage() : 0;
+    return profile;
+}
+
+/**
+ * @brief Attempts to pick up an item and add it to inventory.
+ *
+ * Applies the item's modifiers if picked up successfully. Respects weight and category constraints.
+ *
+ * @param item Catalogue item to pick up.
+ * @return True if pickup succeeded, false otherwise.
+ */
+bool Character::pickUp(const Item *item)
+{
+    if (!item || !canPickUp(*item)) return false;
+
+    modifiers_ += item->getModifiers();
+    recomputeStats();
+    carriedWeight_ += item->getWeight();
+    store(item);
+    return true;
+}
+
+/**
+ * @brief Applies the category and weight rules of pickUp() to an item.
+ *
+ * The category rule is a single slot test.
+ *
+ * @param item Item to test.
+ * @return True if the item could be picked up now.
+ */
+bool Character::canPickUp(const Item &item) const
+{
+    const ItemType t = item.getType();
+    if (t != ItemType::RING && equipment_[static_cast<size_t>(t)]) return false;
+    return carriedWeight_ + item.getWeight() <= strength_;
+}
+
+/**
+ * @brief Removes an item from the inventory by index.
+ *
+ * Reverses the item's modifiers and updates carried weight.
+ *
+ * @param index Inventory index of the item to remove.
+ * @return The removed item, or nullptr if index invalid.
+ */
+const Item *Character::removeItem(size_t index)
+{
+    if (index >= inventorySize()) return nullptr;
+    const Item *taken;
+    const size_t slot = slotAt(index);
+    if (slot < EQUIPMENT_SLOTS) {
+        taken = equipment_[slot];
+        equipment_[slot] = nullptr;
+    } else {
+        InventoryEntry &stack = ringStacks_[index - filledSlots()];
+        taken = stack.item;
+        if (--stack.count == 0) {
+            stack = ringStacks_.back();
+            ringStacks_.pop_back();
+        }
+    }
+    modifiers_ -= taken->getModifiers();
+    recomputeStats();
+    carriedWeight_ -= taken->getWeight();
+    if (carriedWeight_ < 0) carriedWeight_ = 0;
+    return taken;
+}
+
+/**
+ * @brief Counts the items carried: one per filled slot plus every stacked ring.
+ * @return Number of items.
+ */
+int Character::itemCount() const
+{
+    int count = static_cast<int>(filledSlots());
+    for (const InventoryEntry &stack : ringStacks_) count += stack.count;
+    return count;
+}
+
+/**
+ * @brief Returns the inventory entry at an index (filled slots first, then ring stacks).
+ * @param index Inventory index.
+ * @return The item and its count.
+ */
+InventoryEntry Character::inventoryEntry(size_t index) const
+{
+    const size_t slot = slotAt(index);
+    if (slot < EQUIPMENT_SLOTS) return {equipment_[slot], 1};
+    return ringStacks_[index - filledSlots()];
+}
+
+/**
+ * @brief Re-adds an item to inventory.
+ *
+ * Applies the item's modifiers and updates carried weight. Will not add if capacity exceeded.
+ *
+ * @param item Catalogue item to re-add.
+ */
+void Character::addItemBack(const Item *item)
+{
+    if (!item) return;
+    if (carriedWeight_ + item->getWeight() > strength_) return;
+    if (item->getType() != ItemType::RING && equipment_[static_cast<size_t>(item->getType())]) return;
+    modifiers_ += item->getModifiers();
+    recomputeStats();
+    carriedWeight_ += item->getWeight();
+    store(item);
+}
+
+/**
+ * @brief Restores a previously saved inventory, applying all item modifiers as one batch.
+ *
+ * @param items Items in their original inventory order.
+ */
+void Character::restoreInventory(const std::vector<const Item*> &items)
+{
+    for (const Item *item : items) {
+        if (!item) continue;
+        if (item->getType() != ItemType::RING && equipment_[static_cast<size_t>(item->getType())]) continue;
+        modifiers_ += item->getModifiers();
+        carriedWeight_ += item->getWeight();
+        store(item);
+    }
+    recomputeStats();
+}
+
+/**
+ * @brief Replaces the base stats and re-derives the effective ones.
+ * @param stats New base stat line.
+ */
+void Character::setBaseStats(const Constants::RaceStats &stats)
+{
+    baseAttack_ = stats.attack;
+    baseDefence_ = stats.defence;
+    baseHealth_ = stats.health;
+    baseStrength_ = stats.strength;
+    attackChance_ = stats.attackChance;
+    defenceChance_ = stats.defenceChance;
+    recomputeStats();
+}
+
+/**
+ * @brief Re-derives effective attack, defence, strength and health from base + modifiers.
+ */
+void Character::recomputeStats()
+{
+    attack_ = std::max(0, baseAttack_ + modifiers_.attack);
+    defence_ = std::max(0, baseDefence_ + modifiers_.defence);
+    strength_ = std::max(0, baseStrength_ + modifiers_.strength);
+    health_ = std::max(0, baseHealth_ + modifiers_.health + healthDelta_);
+}
+
+/**
+ * @brief Counts the filled equipment slots.
+ * @return 0 to EQUIPMENT_SLOTS.
+ */
+size_t Character::filledSlots() const
+{
+    return (equipment_[0] != nullptr) + (equipment_[1] != nullptr) + (equipment_[2] != nullptr);
+}
+
+/**
+ * @brief Stores an item in its equipment slot, or on the stack of identical rings.
+ *
+ * There are only a handful of ring kinds, so finding the stack is a short scan.
+ *
+ * @param item Item to store.
+ */
+void Character::store(const Item *item)
+{
+    if (item->getType() == ItemType::RING) {
+        for (InventoryEntry &stack : ringStacks_) {
+            if (stack.item == item) {
+                ++stack.count;
+                return;
+            }
+        }
+        ringStacks_.push_back({item, 1});
+    } else {
+        equipment_[static_cast<size_t>(item->getType())] = item;
+    }
+}
+
+/**
+ * @brief Finds the equipment slot listed at an inventory index.
+ *
+ * Filled slots are numbered first, in slot order, so at most three slots are examined.
+ *
+ * @param index Inventory index.
+ * @return Slot index, or EQUIPMENT_SLOTS for a ring index.
+ */
+size_t Character::slotAt(size_t index) const
+{
+    for (size_t slot = 0; slot < EQUIPMENT_SLOTS; ++slot) {
+        if (!equipment_[slot]) continue;
+        if (index == 0) return slot;
+        --index;
+    }
+    return EQUIPMENT_SLOTS;
+}
+
+/**
+ * @brief Prints the inventory contents and total weight carried.
+ *
+ * Each ring stack is one line, e.g. "Ring of Life x3 (w=3)".
+ */
+void Character::printInventory() const
+{
+    const size_t entries = inventorySize();
+    std::cout << "Inventory (" << itemCount() << ") weight " << carriedWeight_ << "/" << strength_ << ":\n";
+    for (size_t i = 0; i < entries; ++i) {
+        const InventoryEntry entry = inventoryEntry(i);
+        std::cout << " [" << i << "] " << entry.item->getName();
+        if (entry.count > 1) std::cout << " x" << entry.count;
+        std::cout << " (w=" << entry.item->getWeight() * entry.count << ")\n";
+    }
+}
@@ -1,258 +1,413 @@
-/**
- * @file Character.h
- * @brief Declares the Character abstract base class for all playable and non-playable races.
- *
- * The Character class encapsulates all shared functionality between Player and Enemy,
- * including:
- *   - Base and effective combat statistics (attack, defence, health, strength)
- *   - Probabilistic attack and defence resolution
- *   - Inventory management (unique_ptr<Item>)
- *   - Stat modification used by item effects
- *
- * Subclasses (Player, Enemy) must implement:
- *   - getName()                  — race-specific display name
- *   - handleSuccessfulDefence()  — race-specific reaction logic when defence succeeds
- *
- * Ownership Model:
- *   - Inventory is stored as std::vector<std::unique_ptr<Item>>
- *     ensuring exclusive ownership and safe transfer on pickup/drop.
- */
-
-#ifndef CHARACTER_H
-#define CHARACTER_H
-
-#include <string>
-#include <vector>
-#include <memory>
-#include "Item.h"
-
-/**
- * @class Character
- * @brief Abstract base class for all races and characters in the game.
- *
- * Provides:
- *  - Combat logic (attack/defence probabilities)
- *  - Effective stats dynamically modified by items
- *  - Inventory management using unique_ptr<Item>
- *  - Weight management based on Strength
- *  - Hooks for race-specific defence behaviour
- *
- * This class is designed to support:
- *  - Player races (Human, Elf, Dwarf, Hobbit, Orc)
- *  - Enemy entities (with simplified rules)
- */
-class Character {
-public:
-
-    /**
-     * @brief Constructs a Character with base statistics.
-     *
-     * @param raceName      Name of the race ("Human", "Elf", etc.)
-     * @param attack        Base attack value
-     * @param attackChance  Probability of successful attack [0,1]
-     * @param defence       Base defence value
-     * @param defenceChance Probability of successful defence [0,1]
-     * @param health        Starting health
-     * @param strength      Weight capacity (limits inventory)
-     */
-    Character(const std::string &raceName,
-              int attack, double attackChance,
-              int defence, double defenceChance,
-              int health, int strength);
-
-    virtual ~Character() = default;
-
-    /**
-     * @brief Returns the race/name of the character.
-     *
-     * Implemented by subclasses (Player, Enemy).
-     *
-     * @return Race-specific string name.
-     */
-    virtual std::string getName() const = 0;
-
-    /**
-     * @brief Performs a generic attack: this (attacker) → target.
-     *
-     * PSEUDOCODE:
-     * 1. If target == nullptr → return immediately.
-     * 2. Roll attackSuccess():
-     *       - If false → print "attack missed", return.
-     * 3. Roll target->defenceSuccess():
-     *       - If true → apply target->handleSuccessfulDefence() and return.
-     * 4. Compute rawDamage = this->attack_ - target->defence_
-     * 5. If rawDamage < 0 → rawDamage = 0
-     * 6. target->health_ -= rawDamage
-     * 7. If target->health_ <= 0:
-     *       - target dies (Enemy awards gold externally)
-     *
-     * @param target Pointer to the character being attacked.
-     */
-    void attack(Character *target);
-
-    // ---------------------------------------------------------------------
-    // Inventory Management
-    // ---------------------------------------------------------------------
-
-    /**
-     * @brief Attempts to pick up an item and add it to inventory.
-     *
-     * PSEUDOCODE:
-     * 1. If item == nullptr → return false.
-     * 2. If carriedWeight_ + item->weight > strength_ → return false.
-     * 3. If item category already equipped (weapon/armour/shield):
-     *        - unless item is a ring → return false.
-     * 4. Transfer ownership: inventory_.push_back(move(item))
-     * 5. Apply item's effect to this character.
-     * 6. Update carriedWeight_.
-     * 7. return true.
-     *
-     * @param item unique_ptr<Item> to take ownership of.
-     * @return true if successfully picked up.
-     */
-    bool pickUp(std::unique_ptr<Item> item);
-
-    /**
-     * @brief Removes an item from inventory at the given index.
-     *
-     * PSEUDOCODE:
-     * 1. If index >= inventory_.size() → return nullptr
-     * 2. itemPtr = move(inventory_[index])
-     * 3. Apply reverse effect via itemPtr->removeEffect()
-     * 4. carriedWeight_ -= itemPtr->weight
-     * 5. return itemPtr
-     *
-     * Ownership transfers OUT of the inventory.
-     *
-     * @param index Index within inventory_.
-     * @return unique_ptr<Item> removed from inventory.
-     */
-    std::unique_ptr<Item> removeItem(size_t index);
-
-    /**
-     * @brief Adds an item back to the inventory (used after failed drops).
-     *
-     * @param item unique_ptr<Item> that regains ownership.
-     */
-    void addItemBack(std::unique_ptr<Item> item);
-
-    /**
-     * @brief Prints all items currently in inventory.
-     *
-     * Format:
-     *   [index]  <ItemName>  (weight W)
-     *   ...
-     */
-    void printInventory() const;
-
-    /**
-     * @brief Returns true if health_ > 0.
-     */
-    bool isAlive() const { return health_ > 0; }
-
-    // ---------------------------------------------------------------------
-    // Getters
-    // ---------------------------------------------------------------------
-
-    /// @return Effective attack value (after item modifiers).
-    int getAttack() const { return attack_; }
-
-    /// @return Effective defence value.
-    int getDefence() const { return defence_; }
-
-    /// @return Current health.
-    int getHealth() const { return health_; }
-
-    /// @return Current strength (weight capacity).
-    int getStrength() const { return strength_; }
-
-    /**
-     * @brief Returns the effective defence value for reward calculation.
-     *
-     * Some games use: enemy reward = enemy.defence.
-     * Subclasses may override.
-     *
-     * @return Defence value including item effects.
-     */
-    virtual int getDefenceValueWithItems() const { return defence_; }
-
-    // ---------------------------------------------------------------------
-    // Public Modifiers (used by Item subclasses)
-    // ---------------------------------------------------------------------
-
-    void modifyAttack(int delta)   { attack_ += delta; if (attack_ < 0) attack_ = 0; }
-    void modifyDefence(int delta)  { defence_ += delta; if (defence_ < 0) defence_ = 0; }
-    void modifyHealth(int delta)   { health_ += delta; if (health_ < 0) health_ = 0; }
-    void modifyStrength(int delta) { strength_ += delta; if (strength_ < 0) strength_ = 0; }
-
-    // Setters for day/night modifications (e.g., Orc behaviour)
-    void setAttack(int v)          { attack_ = v; }
-    void setAttackChance(double v) { attackChance_ = v; }
-    void setDefence(int v)         { defence_ = v; }
-    void setDefenceChance(double v){ defenceChance_ = v; }
-
-protected:
-    // ---------------------------------------------------------------------
-    // Race + Base Stats
-    // ---------------------------------------------------------------------
-
-    std::string race_;        ///< Race tag for display and behaviour.
-
-    int baseAttack_;          ///< Base attack (before item effects).
-    int baseDefence_;         ///< Base defence.
-    int baseHealth_;          ///< Base health.
-    int baseStrength_;        ///< Base strength (max carry weight).
-
-    // ---------------------------------------------------------------------
-    // Effective Stats (modifiable)
-    // ---------------------------------------------------------------------
-
-    int attack_;              ///< Current attack value.
-    int defence_;             ///< Current defence value.
-    int health_;              ///< Current health.
-    int strength_;            ///< Current strength capacity.
-    int carriedWeight_ = 0;   ///< Total carried weight.
-
-    double attackChance_;     ///< Probability [0,1] of successful attack.
-    double defenceChance_;    ///< Probability [0,1] of successful defence.
-
-    std::vector<std::unique_ptr<Item>> inventory_; ///< Character inventory.
-
-    // ---------------------------------------------------------------------
-    // Internal helpers
-    // ---------------------------------------------------------------------
-
-    /**
-     * @brief Rolls for attack success.
-     * @return true if random() < attackChance
-     */
-    bool attackSuccess() const;
-
-    /**
-     * @brief Rolls for defence success.
-     * @return true if random() < defenceChance
-     */
-    bool defenceSuccess() const;
-
-    /**
-     * @brief Race-specific defence behaviour hook.
-     *
-     * Implemented by Player subclasses or Enemy.
-     *
-     * PSEUDOCODE (example for races):
-     *  Human/Dwarf:
-     *      return 0 damage (block completely)
-     *  Elf:
-     *      health_ += 1; return 0
-     *  Hobbit:
-     *      return random damage 0–5
-     *  Orc:
-     *      if day: return (incomingDamage / 4)
-     *      if night: health_ += 1; return 0
-     *
-     * @return Amount of damage applied after successful defence.
-     */
-    virtual int handleSuccessfulDefence() = 0;
-};
-
-#endif // CHARACTER_H
+/**
+ * @file Character.h
+ * @brief Declares the Character abstract base class for all playable and non-playable races.
+ *
+ * The Character class encapsulates all shared functionality between Player and Enemy,
+ * including:
+ *   - Base and effective combat statistics (attack, defence, health, strength)
+ *   - Probabilistic attack and defence resolution
+ *   - Inventory management (catalogue Item pointers)
+ *   - Effective stats derived from base stats plus summed item modifiers
+ *
+ * Subclasses (Player, Enemy) must implement:
+ *   - getName()                  — race-specific display name
+ *
+ * Race-specific behaviour (stats, night stats, the reaction to a successful
+ * defence) comes from the compile-time race tables in Constants.
+ *
+ * Ownership Model:
+ *   - Inventory holds `const Item*` pointers into the shared, immutable
+ *     ItemFactory catalogue; a Character owns no Item objects, so
+ *     pickup/drop only move a pointer.
+ *   - Weapon, armour and shield each have a fixed equipment slot; rings go
+ *     into a separate compact container. The category check and removal
+ *     are therefore O(1) however many rings are carried.
+ *   - Identical rings share one (item, count) stack, so the ring container
+ *     grows with the number of distinct ring types, not rings carried.
+ */
+
+#ifndef CHARACTER_H
+#define CHARACTER_H
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include "CombatEventSink.h"
+#include "Constants.h"
+#include "Item.h"
+
+/**
+ * @struct InventoryEntry
+ * @brief One inventory line: a catalogue item and how many of it are carried.
+ *
+ * Equipment slots always have a count of 1; rings of one kind share an entry.
+ */
+struct InventoryEntry {
+    const Item *item; ///< Catalogue item.
+    int count;        ///< Number carried, at least 1.
+};
+
+/**
+ * @class Character
+ * @brief Abstract base class for all races and characters in the game.
+ *
+ * Provides:
+ *  - Combat logic (attack/defence probabilities)
+ *  - Effective stats = base stats + the summed StatModifiers of carried items
+ *  - Inventory management using catalogue Item pointers
+ *  - Weight management based on Strength
+ *  - Hooks for race-specific defence behaviour
+ *
+ * This class is designed to support:
+ *  - Player races (Human, Elf, Dwarf, Hobbit, Orc)
+ *  - Enemy entities (with simplified rules)
+ */
+class Character {
+public:
+
+    /**
+     * @brief Constructs a Character with the daytime base statistics of a race.
+     *
+     * The stats are one index into Constants::RACE_STATS (generated from
+     * GameData.def).
+     *
+     * @param race Race of the character.
+     */
+    explicit Character(Constants::Race race);
+
+    virtual ~Character() = default;
+
+    /**
+     * @brief Returns the race/name of the character.
+     *
+     * Implemented by subclasses (Player, Enemy) with a lookup in a
+     * compile-time name table, so logging a name never allocates.
+     *
+     * @return Race-specific name; a view of static storage.
+     */
+    virtual std::string_view getName() const = 0;
+
+    /// @return Race tag ("Human", "Elf", ...); a view of static storage.
+    std::string_view getRace() const { return race_; }
+
+    /// @return Race enumerator (its value is the race code).
+    Constants::Race getRaceId() const { return raceId_; }
+
+    /**
+     * @brief Resolves one attack: this (attacker) → target, without any output.
+     *
+     * PSEUDOCODE:
+     * 1. If target is already dead → ALREADY_DEFEATED.
+     * 2. Roll attackSuccess():
+     *       - If false → MISSED.
+     * 3. Roll target.defenceSuccess():
+     *       - If true → target.health_ -= target.handleSuccessfulDefence() → DEFENDED.
+     * 4. Compute rawDamage = this->attack_ - target.defence_
+     * 5. If rawDamage < 0 → rawDamage = 0
+     * 6. target.health_ -= rawDamage → HIT
+     * 7. killed = target.health_ <= 0 (Enemy awards gold externally)
+     *
+     * @param target Character being attacked.
+     * @return What happened and how much damage the target took.
+     */
+    CombatOutcome resolveAttack(Character &target);
+
+    /// Highest damage a RANDOM_DAMAGE defence reaction deals to the defender itself (the lowest is 0).
+    static constexpr int MAX_RANDOM_DEFENCE_DAMAGE = 5;
+
+    /**
+     * @struct CombatProfile
+     * @brief Everything resolveAttack() uses about one side of a fight.
+     */
+    struct CombatProfile {
+        double attackChance = 0.0;  ///< Probability that an attack roll succeeds.
+        double defenceChance = 0.0; ///< Probability that a defence roll succeeds.
+        int health = 0;             ///< Current health.
+        int hitDamage = 0;          ///< Damage a hit deals to the opponent: max(0, attack - opponent defence).
+        Constants::DefenceReaction reaction = Constants::DefenceReaction::NONE; ///< Reaction to a successful defence.
+        int counterDamage = 0;      ///< Damage a COUNTER reaction deals to this side itself (0 for other reactions).
+    };
+
+    /**
+     * @brief Describes this character as one side of a fight, for combat analysis.
+     * @param opponent The other side (its defence sets hitDamage).
+     * @param night Time of day (selects the defence reaction).
+     * @return The profile, from the current effective stats.
+     */
+    CombatProfile combatProfile(const Character &opponent, bool night) const;
+
+    /**
+     * @brief Performs a generic attack: resolveAttack() and report it to a sink.
+     *
+     * @param target Pointer to the character being attacked; nullptr gives NO_TARGET.
+     * @param sink Receives the ATTACK event; prints to the console by default.
+     * @return The outcome.
+     */
+    CombatOutcome attack(Character *target, CombatEventSink &sink = ConsoleCombatSink::instance());
+
+    // ---------------------------------------------------------------------
+    // Inventory Management
+    // ---------------------------------------------------------------------
+
+    /**
+     * @brief Attempts to pick up an item and add it to inventory.
+     *
+     * PSEUDOCODE:
+     * 1. If item == nullptr → return false.
+     * 2. If carriedWeight_ + item->weight > strength_ → return false.
+     * 3. If item is not a ring and its slot is already filled → return false.
+     * 4. Put item into its slot, or add 1 to its ring stack
+     * 5. modifiers_ += item's modifiers; recompute effective stats.
+     * 6. Update carriedWeight_.
+     * 7. return true.
+     *
+     * @param item Catalogue item to carry.
+     * @return true if successfully picked up.
+     */
+    bool pickUp(const Item *item);
+
+    /**
+     * @brief Checks whether pickUp() would accept an item, without taking it.
+     *
+     * @param item Item to test.
+     * @return true if the category and weight rules allow carrying it.
+     */
+    bool canPickUp(const Item &item) const;
+
+    /**
+     * @brief Removes one item from the inventory entry at the given index.
+     *
+     * Inventory indices list the filled equipment slots first (weapon,
+     * armour, shield), then the ring stacks; see inventoryEntry().
+     *
+     * PSEUDOCODE:
+     * 1. If index >= inventorySize() → return nullptr
+     * 2. itemPtr = the slot or ring stack at index
+     * 3. Empty the slot, or take 1 from the stack
+     *        - an emptied stack is replaced by the last stack
+     * 4. modifiers_ -= itemPtr's modifiers; recompute effective stats
+     * 5. carriedWeight_ -= itemPtr->weight
+     * 6. return itemPtr
+     *
+     * @param index Inventory index.
+     * @return The item removed from inventory.
+     *
+     * @note O(1). Emptying a ring stack moves the last stack to its index.
+     */
+    const Item *removeItem(size_t index);
+
+    /// @return Number of inventory entries (filled slots + ring stacks).
+    size_t inventorySize() const { return filledSlots() + ringStacks_.size(); }
+
+    /// @return Number of items carried, counting every ring in a stack.
+    int itemCount() const;
+
+    /**
+     * @brief Returns the inventory entry at an index.
+     * @param index Inventory index. @pre index < inventorySize()
+     * @return The item and how many of it are carried.
+     */
+    InventoryEntry inventoryEntry(size_t index) const;
+
+    /**
+     * @brief Adds an item back to the inventory (used after failed drops).
+     *
+     * @param item Item to carry again.
+     */
+    void addItemBack(const Item *item);
+
+    /**
+     * @brief Restores a saved inventory without pickup checks.
+     *
+     * The saved inventory was valid when it was written, but re-picking items
+     * one by one could fail on weight (e.g. a strength ring picked up late),
+     * so items are applied unconditionally, in order. Their modifiers are
+     * summed first and the effective stats recomputed once for the batch.
+     *
+     * @param items Items to carry.
+     */
+    void restoreInventory(const std::vector<const Item*> &items);
+
+    /**
+     * @brief Prints all items currently in inventory.
+     *
+     * Format:
+     *   [index]  <ItemName>  (weight W)
+     *   ...
+     */
+    void printInventory() const;
+
+    /**
+     * @brief Returns true if health_ > 0.
+     */
+    bool isAlive() const { return health_ > 0; }
+
+    // ---------------------------------------------------------------------
+    // Getters
+    // ---------------------------------------------------------------------
+
+    /// @return Effective attack value (after item modifiers).
+    int getAttack() const { return attack_; }
+
+    /// @return Effective defence value.
+    int getDefence() const { return defence_; }
+
+    /// @return Current health.
+    int getHealth() const { return health_; }
+
+    /// @return Current strength (weight capacity).
+    int getStrength() const { return strength_; }
+
+    /// @return Probability [0,1] of a successful attack.
+    double getAttackChance() const { return attackChance_; }
+
+    /// @return Probability [0,1] of a successful defence.
+    double getDefenceChance() const { return defenceChance_; }
+
+    /// @return Base stats, before item modifiers; health is the race's, not the current value.
+    Constants::RaceStats getBaseStats() const {
+        return {baseAttack_, attackChance_, baseDefence_, defenceChance_, baseHealth_, baseStrength_};
+    }
+
+    /**
+     * @brief Returns the effective defence value for reward calculation.
+     *
+     * Some games use: enemy reward = enemy.defence.
+     * Subclasses may override.
+     *
+     * @return Defence value including item effects.
+     */
+    virtual int getDefenceValueWithItems() const { return defence_; }
+
+    /// @return Sum of the stat modifiers of every carried item.
+    const StatModifiers &getModifiers() const { return modifiers_; }
+
+    // ---------------------------------------------------------------------
+    // Public Modifiers
+    // ---------------------------------------------------------------------
+
+    /// Applies combat damage (negative) or healing (positive); health never drops below 0.
+    void modifyHealth(int delta)   { setHealth(std::max(health_ + delta, 0)); }
+
+    /// Sets current health directly (e.g. when loading); item modifiers keep applying on top.
+    void setHealth(int v)          { healthDelta_ = v - (baseHealth_ + modifiers_.health); health_ = v; }
+
+    /**
+     * @brief Replaces the base stats, e.g. for the day/night switch (Orc behaviour).
+     *
+     * Item modifiers are kept and re-applied on top of the new base, and
+     * damage taken so far still counts.
+     *
+     * @param stats New base stat line (usually Constants::raceStats(race, night)).
+     */
+    void setBaseStats(const Constants::RaceStats &stats);
+
+protected:
+    // ---------------------------------------------------------------------
+    // Race + Base Stats
+    // ---------------------------------------------------------------------
+
+    std::string_view race_;   ///< Race tag for display and behaviour (Constants::RACE_NAMES entry).
+    Constants::Race raceId_;  ///< Race as an enumerator, for table lookups.
+
+    int baseAttack_;          ///< Base attack (before item effects).
+    int baseDefence_;         ///< Base defence.
+    int baseHealth_;          ///< Base health.
+    int baseStrength_;        ///< Base strength (max carry weight).
+
+    StatModifiers modifiers_; ///< Sum of the modifiers of every carried item.
+    int healthDelta_ = 0;     ///< Health gained (+) or lost (−) in play, relative to base + modifiers.
+
+    // ---------------------------------------------------------------------
+    // Effective Stats (derived by recomputeStats())
+    // ---------------------------------------------------------------------
+
+    int attack_;              ///< Current attack value.
+    int defence_;             ///< Current defence value.
+    int health_;              ///< Current health.
+    int strength_;            ///< Current strength capacity.
+    int carriedWeight_ = 0;   ///< Total carried weight.
+
+    double attackChance_;     ///< Probability [0,1] of successful attack.
+    double defenceChance_;    ///< Probability [0,1] of successful defence.
+
+    /// Number of equipment slots: one each for weapon, armour and shield.
+    static constexpr size_t EQUIPMENT_SLOTS = 3;
+
+    /// Equipped weapon/armour/shield, indexed by ItemType; nullptr when empty.
+    std::array<const Item*, EQUIPMENT_SLOTS> equipment_{};
+    std::vector<InventoryEntry> ringStacks_; ///< One stack per ring kind carried, in no particular order.
+
+    // ---------------------------------------------------------------------
+    // Internal helpers
+    // ---------------------------------------------------------------------
+
+    /**
+     * @brief Rolls for attack success.
+     * @return true if random() < attackChance
+     */
+    bool attackSuccess() const;
+
+    /**
+     * @brief Rolls for defence success.
+     * @return true if random() < defenceChance
+     */
+    bool defenceSuccess() const;
+
+    /**
+     * @brief Derives every effective stat from base + modifiers_ in one pass.
+     *
+     * attack/defence/strength = max(0, base + modifier) and
+     * health = max(0, base + modifier + healthDelta_). Each max is a
+     * conditional move rather than a branch.
+     */
+    void recomputeStats();
+
+    /// @return Number of filled equipment slots.
+    size_t filledSlots() const;
+
+    /**
+     * @brief Puts an item into its slot or onto its ring stack; no checks, no stat update.
+     * @param item Item to store. @pre its slot (if any) is empty
+     */
+    void store(const Item *item);
+
+    /**
+     * @brief Maps an inventory index to its equipment slot.
+     * @param index Inventory index.
+     * @return Slot index, or EQUIPMENT_SLOTS if index refers to a ring stack.
+     */
+    size_t slotAt(size_t index) const;
+
+    /**
+     * @brief Race-specific reaction to a successful defence.
+     *
+     * The reaction is looked up in Constants::RACE_TRAITS (generated from the
+     * DEFENCE entries of GameData.def) for the race and the time of day, so
+     * no virtual call or string comparison is involved.
+     *
+     * PSEUDOCODE:
+     *  switch defenceReaction(raceId_, isNight):
+     *      NONE:          return 0 damage (block completely)
+     *      HEAL:          health_ += 1; return 0
+     *      RANDOM_DAMAGE: return random damage 0–MAX_RANDOM_DEFENCE_DAMAGE
+     *      COUNTER:       return counterDamage()
+     *
+     * @return Damage this character (the defender) takes itself; resolveAttack()
+     *         subtracts it from the target's health.
+     */
+    int handleSuccessfulDefence();
+
+    /// @return Damage of a COUNTER defence reaction: max(0, baseAttack_ - baseDefence_) / 4.
+    int counterDamage() const { return std::max(0, baseAttack_ - baseDefence_) / 4; }
+
+private:
+
+    /// Delegated to by Character(Race): stats looked up once, then copied into every field.
+    Character(Constants::Race race, const Constants::RaceStats &stats);
+};
+
+#endif // CHARACTER_H
@@ -0,0 +1,105 @@
+#include "CombatEventSink.h"
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @file CombatEventSink.cpp
+ * @brief Implements the console and ring-buffer combat sinks.
+ *
+ * Responsibilities:
+ *  - Turn combat events back into the game's console messages.
+ *  - Keep a bounded history of events in memory.
+ */
+
+/**
+ * @brief Prints the message(s) for one event.
+ *
+ * PSEUDOCODE:
+ *  ATTACK:
+ *      NO_TARGET        → "No target to attack."
+ *      ALREADY_DEFEATED → "<target> is already defeated."
+ *      otherwise        → "<attacker> attacks <target>!" followed by
+ *          MISSED   → "<attacker> missed the attack."
+ *          DEFENDED → "<target> successfully defended (special). Damage taken: <damage>"
+ *          HIT      → "<attacker> deals <damage> damage to <target>."
+ *  COUNTERATTACK   → "<attacker> attempts to counterattack!"
+ *  ENEMY_DEFEATED  → "Enemy defeated! You gained <gold> gold."
+ *  PLAYER_DEFEATED → "You have been defeated! Game over."
+ *
+ * @param event Event to print.
+ */
+void ConsoleCombatSink::record(const CombatEvent &event)
+{
+    switch (event.type) {
+    case CombatEventType::ATTACK:
+        switch (event.outcome.result) {
+        case CombatResult::NO_TARGET:
+            std::cout << "No target to attack.\n";
+            return;
+        case CombatResult::ALREADY_DEFEATED:
+            std::cout << event.target << " is already defeated.\n";
+            return;
+        default:
+            break;
+        }
+        std::cout << event.attacker << " attacks " << event.target << "!\n";
+        if (event.outcome.result == CombatResult::MISSED) {
+            std::cout << event.attacker << " missed the attack.\n";
+        } else if (event.outcome.result == CombatResult::DEFENDED) {
+            std::cout << event.target << " successfully defended (special). Damage taken: "
+                      << event.outcome.damage << "\n";
+        } else {
+            std::cout << event.attacker << " deals " << event.outcome.damage << " damage to " << event.target << ".\n";
+        }
+        break;
+    case CombatEventType::COUNTERATTACK:
+        std::cout << event.attacker << " attempts to counterattack!\n";
+        break;
+    case CombatEventType::ENEMY_DEFEATED:
+        std::cout << "Enemy defeated! You gained " << event.gold << " gold.\n";
+        break;
+    case CombatEventType::PLAYER_DEFEATED:
+        std::cout << "You have been defeated! Game over.\n";
+        break;
+    }
+}
+
+/**
+ * @brief Returns the shared console sink.
+ * @return A sink that lives until program exit.
+ */
+ConsoleCombatSink &ConsoleCombatSink::instance()
+{
+    static ConsoleCombatSink sink;
+    return sink;
+}
+
+/**
+ * @brief Allocates the buffer.
+ * @param capacity Number of events kept; 0 is treated as 1.
+ */
+RingBufferCombatSink::RingBufferCombatSink(size_t capacity)
+    : events_(std::max<size_t>(capacity, 1))
+{
+}
+
+/**
+ * @brief Stores an event, overwriting the oldest one when the buffer is full.
+ * @param event Event to store.
+ */
+void RingBufferCombatSink::record(const CombatEvent &event)
+{
+    events_[total_ % events_.size()] = event;
+    ++total_;
+}
+
+/**
+ * @brief Returns a held event, oldest first.
+ * @param i Index in [0, size()).
+ * @return The event.
+ */
+const CombatEvent &RingBufferCombatSink::operator[](size_t i) const
+{
+    const std::uint64_t first = total_ - size();
+    return events_[(first + i) % events_.size()];
+}
@@ -0,0 +1,140 @@
+/**
+ * @file CombatEventSink.h
+ * @brief Declares the combat outcome record and the sinks combat messages are sent to.
+ *
+ * Combat is resolved without any I/O (Character::resolveAttack) into a
+ * CombatOutcome. Whatever should be said about it is passed as a CombatEvent
+ * to a CombatEventSink, which decides what to do with it:
+ *  - ConsoleCombatSink prints the game's usual combat messages;
+ *  - RingBufferCombatSink keeps the most recent events in memory;
+ *  - NullCombatSink drops them, for headless simulations.
+ */
+
+#ifndef COMBATEVENTSINK_H
+#define COMBATEVENTSINK_H
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * @enum CombatResult
+ * @brief How one attack went.
+ */
+enum class CombatResult : std::uint8_t {
+    NO_TARGET,        ///< There was nothing to attack.
+    ALREADY_DEFEATED, ///< The target was already dead; nothing happened.
+    MISSED,           ///< The attack roll failed.
+    DEFENDED,         ///< The target defended; damage is its special reaction's.
+    HIT               ///< The attack landed; damage is attack - target defence.
+};
+
+/**
+ * @struct CombatOutcome
+ * @brief Structured result of one attack.
+ */
+struct CombatOutcome {
+    CombatResult result = CombatResult::NO_TARGET; ///< What happened.
+    int damage = 0;                                ///< Damage the target took.
+    bool killed = false;                           ///< True if the attack took the target to 0 health.
+};
+
+/**
+ * @enum CombatEventType
+ * @brief Kind of thing a CombatEvent reports.
+ */
+enum class CombatEventType : std::uint8_t {
+    ATTACK,          ///< attacker attacked target; see outcome.
+    COUNTERATTACK,   ///< attacker (an enemy) is about to strike back.
+    ENEMY_DEFEATED,  ///< The player killed an enemy and was paid gold.
+    PLAYER_DEFEATED  ///< The player died.
+};
+
+/**
+ * @struct CombatEvent
+ * @brief One combat message, as data.
+ *
+ * Names are views of static storage (race tags and interned names), so an
+ * event stays valid after the characters it names are gone.
+ */
+struct CombatEvent {
+    CombatEventType type = CombatEventType::ATTACK; ///< What the event reports.
+    std::string_view attacker;                      ///< Acting character's name (empty if none).
+    std::string_view target;                        ///< Target's name (empty if none).
+    CombatOutcome outcome;                          ///< ATTACK only: how it went.
+    int gold = 0;                                   ///< ENEMY_DEFEATED only: the reward.
+};
+
+/**
+ * @class CombatEventSink
+ * @brief Receives combat events; subclasses decide where they go.
+ */
+class CombatEventSink {
+public:
+    virtual ~CombatEventSink() = default;
+
+    /**
+     * @brief Handles one event.
+     * @param event The event; only valid for the duration of the call.
+     */
+    virtual void record(const CombatEvent &event) = 0;
+};
+
+/**
+ * @class ConsoleCombatSink
+ * @brief Prints each event to std::cout as the game always has.
+ */
+class ConsoleCombatSink : public CombatEventSink {
+public:
+    void record(const CombatEvent &event) override;
+
+    /// @return A shared console sink (the default of Board and Character::attack).
+    static ConsoleCombatSink &instance();
+};
+
+/**
+ * @class RingBufferCombatSink
+ * @brief Keeps the last capacity events in a fixed buffer; older ones are overwritten.
+ *
+ * The buffer is allocated once at construction, so recording never allocates.
+ */
+class RingBufferCombatSink : public CombatEventSink {
+public:
+    /**
+     * @brief Creates an empty buffer.
+     * @param capacity Number of events kept (at least 1).
+     */
+    explicit RingBufferCombatSink(size_t capacity);
+
+    void record(const CombatEvent &event) override;
+
+    /// @return Number of events held (at most the capacity).
+    size_t size() const { return total_ < events_.size() ? static_cast<size_t>(total_) : events_.size(); }
+
+    /// @return Number of events recorded since construction or clear(), including overwritten ones.
+    std::uint64_t total() const { return total_; }
+
+    /**
+     * @brief Returns a held event, oldest first.
+     * @param i Index in [0, size()).
+     */
+    const CombatEvent &operator[](size_t i) const;
+
+    /// Forgets every event.
+    void clear() { total_ = 0; }
+
+private:
+    std::vector<CombatEvent> events_; ///< Fixed-size storage, used circularly.
+    std::uint64_t total_ = 0;         ///< Events recorded; the next goes to total_ % capacity.
+};
+
+/**
+ * @class NullCombatSink
+ * @brief Discards every event.
+ */
+class NullCombatSink : public CombatEventSink {
+public:
+    void record(const CombatEvent &) override {}
+};
+
+#endif // COMBATEVENTSINK_H
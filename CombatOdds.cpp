@@ -0,0 +1,320 @@
+#include "CombatOdds.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file CombatOdds.cpp
+ * @brief Implements the memoised Markov chain fight solver.
+ *
+ * Responsibilities:
+ *  - Turn each side's strike into a distribution of health changes.
+ *  - Solve the chain over all health pairs by Gauss-Seidel sweeps.
+ *  - Memoise the solved tables by matchup.
+ */
+
+/// Sweeps after which the solver stops even if it has not settled.
+static constexpr int MAX_SWEEPS = 100000;
+
+/// Largest change in a sweep that counts as settled.
+static constexpr double TOLERANCE = 1e-12;
+
+/// A fight that ends with lower probability than 1 - this may go on forever.
+static constexpr double NEVER_ENDS = 1e-9;
+
+/**
+ * @brief One way a strike can change the defender's health, and its probability.
+ */
+struct Step {
+    int delta;          ///< Change of the defender's health.
+    double probability; ///< Probability of this change.
+};
+
+/**
+ * @brief Everything in a CombatProfile except health; what a solution depends on.
+ */
+struct SideKey {
+    double attackChance;
+    double defenceChance;
+    int hitDamage;
+    Constants::DefenceReaction reaction;
+    int counterDamage;
+
+    bool operator==(const SideKey &o) const {
+        return attackChance == o.attackChance && defenceChance == o.defenceChance && hitDamage == o.hitDamage
+               && reaction == o.reaction && counterDamage == o.counterDamage;
+    }
+};
+
+/// Memo key: both sides of a fight.
+struct MatchupKey {
+    SideKey player;
+    SideKey enemy;
+
+    bool operator==(const MatchupKey &o) const { return player == o.player && enemy == o.enemy; }
+};
+
+/// Hash of a MatchupKey: its fields combined boost-style.
+struct MatchupKeyHash {
+    size_t operator()(const MatchupKey &k) const {
+        size_t h = 0;
+        auto mix = [&h](size_t v) { h ^= v + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2); };
+        for (const SideKey *s : {&k.player, &k.enemy}) {
+            mix(std::hash<double>()(s->attackChance));
+            mix(std::hash<double>()(s->defenceChance));
+            mix(static_cast<size_t>(s->hitDamage));
+            mix(static_cast<size_t>(s->reaction));
+            mix(static_cast<size_t>(s->counterDamage));
+        }
+        return h;
+    }
+};
+
+/**
+ * @brief Solved odds of one matchup for every health pair up to the bounds.
+ *
+ * odds[p * (maxEnemyHealth + 1) + e] → Odds from player health p, enemy health e.
+ */
+struct OddsTable {
+    int maxPlayerHealth = 0;
+    int maxEnemyHealth = 0;
+    std::vector<CombatOdds::Odds> odds;
+
+    CombatOdds::Odds &at(int p, int e) { return odds[static_cast<size_t>(p) * (maxEnemyHealth + 1) + e]; }
+};
+
+/// The shared memo and its lock.
+struct Memo {
+    std::mutex mutex;
+    std::unordered_map<MatchupKey, OddsTable, MatchupKeyHash> tables;
+};
+
+/// @return The memo (built on first use).
+static Memo &memo()
+{
+    static Memo instance;
+    return instance;
+}
+
+/**
+ * @brief Strips health from a profile.
+ * @param p Profile.
+ * @return Its key.
+ */
+static SideKey sideKey(const Character::CombatProfile &p)
+{
+    return {p.attackChance, p.defenceChance, p.hitDamage, p.reaction, p.counterDamage};
+}
+
+/**
+ * @brief Lists the health changes one strike can cause the defender, as in Character::resolveAttack.
+ *
+ * PSEUDOCODE:
+ *  miss (1 - attackChance)                        → 0
+ *  hit, not defended                              → -hitDamage
+ *  hit, defended (attackChance * defenceChance)   → by the defender's reaction:
+ *      NONE 0, HEAL +1, COUNTER -counterDamage,
+ *      RANDOM_DAMAGE -k for each k in 0..MAX_RANDOM_DEFENCE_DAMAGE, equally likely
+ *
+ * @param attacker Striking side.
+ * @param defender Struck side.
+ * @return The changes, each delta listed once.
+ */
+static std::vector<Step> strikeSteps(const SideKey &attacker, const SideKey &defender)
+{
+    std::vector<Step> steps;
+    auto add = [&steps](int delta, double probability) {
+        if (probability <= 0.0) return;
+        for (Step &s : steps) {
+            if (s.delta == delta) {
+                s.probability += probability;
+                return;
+            }
+        }
+        steps.push_back({delta, probability});
+    };
+
+    const double hit = attacker.attackChance;
+    const double defended = hit * defender.defenceChance;
+    add(0, 1.0 - hit);
+    add(-attacker.hitDamage, hit - defended);
+    switch (defender.reaction) {
+    case Constants::DefenceReaction::NONE:
+        add(0, defended);
+        break;
+    case Constants::DefenceReaction::HEAL:
+        add(+1, defended);
+        break;
+    case Constants::DefenceReaction::RANDOM_DAMAGE:
+        for (int k = 0; k <= Character::MAX_RANDOM_DEFENCE_DAMAGE; ++k) {
+            add(-k, defended / (Character::MAX_RANDOM_DEFENCE_DAMAGE + 1));
+        }
+        break;
+    case Constants::DefenceReaction::COUNTER:
+        add(-defender.counterDamage, defended);
+        break;
+    }
+    return steps;
+}
+
+/**
+ * @brief Solves a matchup's chain over every health pair within the table's bounds.
+ *
+ * For each live state s, with q(s→s') the probability of a round going from
+ * s to s' (player strike, then enemy strike if the enemy survives):
+ *   win(s)    = q(enemy dies) + Σ q(s→s') win(s')
+ *   loss(s)   = q(player dies) + Σ q(s→s') loss(s')
+ *   health(s) = q(enemy dies) * p + Σ q(s→s') health(s')
+ *   rounds(s) = 1 + Σ q(s→s') rounds(s')
+ * The self-loop term is moved to the left-hand side. States are swept in
+ * increasing health, so without healing (every step ≤ 0) one sweep is
+ * exact; healing steps use the previous sweep and need a few more.
+ * rounds is only solved where the fight surely ends.
+ *
+ * @param t Table with its bounds set; filled in.
+ * @param playerStrike Steps of the player's strike on the enemy.
+ * @param enemyStrike Steps of the enemy's strike on the player.
+ */
+static void solve(OddsTable &t, const std::vector<Step> &playerStrike, const std::vector<Step> &enemyStrike)
+{
+    const int maxP = t.maxPlayerHealth, maxE = t.maxEnemyHealth;
+    t.odds.assign(static_cast<size_t>(maxP + 1) * (maxE + 1), CombatOdds::Odds{});
+
+    // Visits every continuing transition of (p, e): next(q, np, ne), ending ones: ends(q, enemyDied)
+    auto round = [&](int p, int e, auto &&next, auto &&ends) {
+        for (const Step &a : playerStrike) {
+            const int ne = std::min(e + a.delta, maxE);
+            if (ne <= 0) {
+                ends(a.probability, true);
+                continue;
+            }
+            for (const Step &b : enemyStrike) {
+                const double q = a.probability * b.probability;
+                const int np = std::min(p + b.delta, maxP);
+                if (np <= 0) ends(q, false);
+                else next(q, np, ne);
+            }
+        }
+    };
+
+    // 1. Absorption probabilities and final health
+    for (int sweep = 0; sweep < MAX_SWEEPS; ++sweep) {
+        double change = 0.0;
+        for (int p = 1; p <= maxP; ++p) {
+            for (int e = 1; e <= maxE; ++e) {
+                double win = 0.0, loss = 0.0, health = 0.0, self = 0.0;
+                round(p, e,
+                      [&](double q, int np, int ne) {
+                          if (np == p && ne == e) {
+                              self += q;
+                              return;
+                          }
+                          const CombatOdds::Odds &n = t.at(np, ne);
+                          win += q * n.win;
+                          loss += q * n.loss;
+                          health += q * n.expectedHealth;
+                      },
+                      [&](double q, bool enemyDied) {
+                          if (enemyDied) {
+                              win += q;
+                              health += q * p;
+                          } else {
+                              loss += q;
+                          }
+                      });
+                if (self >= 1.0) continue; // nothing can ever change
+                CombatOdds::Odds &o = t.at(p, e);
+                const double scale = 1.0 / (1.0 - self);
+                win *= scale;
+                loss *= scale;
+                health *= scale;
+                change = std::max({change, std::fabs(win - o.win), std::fabs(loss - o.loss),
+                                   std::fabs(health - o.expectedHealth) / std::max(1.0, health)});
+                o.win = win;
+                o.loss = loss;
+                o.expectedHealth = health;
+            }
+        }
+        if (change < TOLERANCE) break;
+    }
+
+    // 2. Expected rounds
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    for (int sweep = 0; sweep < MAX_SWEEPS; ++sweep) {
+        double change = 0.0;
+        for (int p = 1; p <= maxP; ++p) {
+            for (int e = 1; e <= maxE; ++e) {
+                CombatOdds::Odds &o = t.at(p, e);
+                if (o.win + o.loss < 1.0 - NEVER_ENDS) {
+                    o.expectedRounds = INF;
+                    continue;
+                }
+                double rounds = 1.0, self = 0.0;
+                round(p, e,
+                      [&](double q, int np, int ne) {
+                          if (np == p && ne == e) self += q;
+                          else rounds += q * t.at(np, ne).expectedRounds;
+                      },
+                      [](double, bool) {});
+                rounds /= 1.0 - self;
+                const double diff = std::fabs(rounds - o.expectedRounds);
+                if (std::isfinite(diff)) change = std::max(change, diff / std::max(1.0, rounds));
+                o.expectedRounds = rounds;
+            }
+        }
+        if (change < TOLERANCE) break;
+    }
+}
+
+/**
+ * @brief Looks the matchup up in the memo, solving it first if needed.
+ */
+CombatOdds::Odds CombatOdds::of(const Character::CombatProfile &player, const Character::CombatProfile &enemy)
+{
+    Odds odds;
+    if (player.health <= 0) {
+        odds.loss = 1.0;
+        return odds;
+    }
+    if (enemy.health <= 0) {
+        odds.win = 1.0;
+        odds.expectedHealth = player.health;
+        return odds;
+    }
+
+    const MatchupKey key{sideKey(player), sideKey(enemy)};
+    const int needP = player.health + (player.reaction == Constants::DefenceReaction::HEAL ? HEAL_MARGIN : 0);
+    const int needE = enemy.health + (enemy.reaction == Constants::DefenceReaction::HEAL ? HEAL_MARGIN : 0);
+
+    Memo &m = memo();
+    std::lock_guard<std::mutex> lock(m.mutex);
+    OddsTable &table = m.tables[key];
+    if (table.maxPlayerHealth < needP || table.maxEnemyHealth < needE) {
+        table.maxPlayerHealth = std::max(table.maxPlayerHealth, needP);
+        table.maxEnemyHealth = std::max(table.maxEnemyHealth, needE);
+        solve(table, strikeSteps(key.player, key.enemy), strikeSteps(key.enemy, key.player));
+    }
+    return table.at(player.health, enemy.health);
+}
+
+/**
+ * @brief Builds both profiles and looks up their odds.
+ */
+CombatOdds::Odds CombatOdds::of(const Character &player, const Character &enemy, bool night)
+{
+    return of(player.combatProfile(enemy, night), enemy.combatProfile(player, night));
+}
+
+/**
+ * @brief Counts the memoised matchups.
+ */
+size_t CombatOdds::cachedMatchups()
+{
+    Memo &m = memo();
+    std::lock_guard<std::mutex> lock(m.mutex);
+    return m.tables.size();
+}
@@ -0,0 +1,88 @@
+/**
+ * @file CombatOdds.h
+ * @brief Declares CombatOdds, which computes the exact outcome odds of a fight.
+ *
+ * A fight (repeated Board::playerAttack: the player strikes, then the enemy
+ * counters if it survives) is a Markov chain over (player health, enemy
+ * health): every strike either misses, is defended (and the defender's
+ * DefenceReaction changes its own health) or hits for a fixed amount. The
+ * chain's absorption probabilities and expected values are found by solving
+ * its linear equations, so the results are exact up to the solver tolerance
+ * rather than sampled.
+ *
+ * Solutions are tables over every health pair, memoised by the two sides'
+ * combat numbers (everything in Character::CombatProfile except health).
+ * Once a matchup has been solved, any later query for it, at any health,
+ * is one hash lookup.
+ */
+
+#ifndef COMBATODDS_H
+#define COMBATODDS_H
+
+#include "Character.h"
+
+/**
+ * @class CombatOdds
+ * @brief Static, memoised Markov chain solver for player-versus-enemy fights.
+ *
+ * Design:
+ *  - All functions are static.
+ *  - No instances are allowed (constructor is deleted).
+ *  - The memo table is shared and guarded by a mutex.
+ */
+class CombatOdds {
+public:
+    /**
+     * @brief Health headroom given to a side whose defence reaction heals.
+     *
+     * Healing can in principle raise health without bound, so the chain is
+     * truncated HEAL_MARGIN points above the health being asked about;
+     * healing past that is capped. Reaching it takes that many successful
+     * defences more than the opponent's hits, which is negligibly unlikely.
+     */
+    static constexpr int HEAL_MARGIN = 32;
+
+    /**
+     * @struct Odds
+     * @brief How a fight ends, from a given pair of health values.
+     */
+    struct Odds {
+        double win = 0.0;            ///< Probability that the player kills the enemy.
+        double loss = 0.0;           ///< Probability that the enemy kills the player.
+        double expectedRounds = 0.0; ///< Expected rounds until it ends; infinity if it may never end.
+        double expectedHealth = 0.0; ///< Expected player health at the end (a loss counts as 0).
+    };
+
+    /**
+     * @brief Odds of a fight between two sides.
+     *
+     * PSEUDOCODE:
+     * 1. key = both profiles without health
+     * 2. If the memo holds a table for key that covers the healths → read it.
+     * 3. Else solve the chain over every health pair up to the needed bounds
+     *    (plus HEAL_MARGIN for sides that heal), store the table, read it.
+     *
+     * @param player Player side (Character::combatProfile).
+     * @param enemy Enemy side.
+     * @return The odds; a side with no health has already lost.
+     */
+    static Odds of(const Character::CombatProfile &player, const Character::CombatProfile &enemy);
+
+    /**
+     * @brief Odds of player attacking enemy now.
+     * @param player Attacker.
+     * @param enemy Defender, who counterattacks.
+     * @param night Time of day.
+     * @return The odds.
+     */
+    static Odds of(const Character &player, const Character &enemy, bool night);
+
+    /// @return Number of matchups solved and memoised so far.
+    static size_t cachedMatchups();
+
+private:
+    /// Private constructor to prevent instantiation
+    CombatOdds() = delete;
+};
+
+#endif // COMBATODDS_H
@@ -1,96 +1,221 @@
-/**
- * @file Constants.h
- * @brief Defines global constants and race stat templates used throughout the game.
- *
- * This header provides:
- *  - The number of commands required to toggle between day and night.
- *  - A RaceStats struct describing the combat and survival attributes for each race.
- *  - Constant RaceStats presets for all player and enemy races, including
- *    day/night variations for Orcs.
- *
- * These values centralize all core balance parameters, ensuring that character
- * construction and race-specific behaviour remain consistent across the program.
- */
-
-#ifndef CONSTANTS_H
-#define CONSTANTS_H
-
-/**
- * @namespace Constants
- * @brief Contains global constant values and race templates used by Characters.
- *
- * All race attributes (attack, defence, health, strength, etc.)
- * are stored as constexpr objects and referenced when initializing Player
- * or Enemy instances. This provides a clean separation between game logic
- * and character configuration.
- */
-namespace Constants {
-
-/// Number of player commands required to trigger day/night change.
-constexpr int COMMANDS_PER_TIME_SWITCH = 5;
-
-/**
- * @struct RaceStats
- * @brief Container for all base statistics of a game race.
- *
- * Each field corresponds to an attribute used during combat or inventory
- * calculations, and is applied when constructing Characters.
- *
- * Fields:
- *  - attack: Base attack value
- *  - attackChance: Probability [0–1] of successful attack
- *  - defence: Base defence value
- *  - defenceChance: Probability [0–1] of successful defence
- *  - health: Starting health
- *  - strength: Weight capacity used for inventory limits
- */
-struct RaceStats {
-    int attack;
-    double attackChance;
-    int defence;
-    double defenceChance;
-    int health;
-    int strength;
-};
-
-// ---------------------------------------------------------------------
-// Player Race Definitions
-// ---------------------------------------------------------------------
-
-/// Human: Balanced stats with moderate attack/defence and high health.
-constexpr RaceStats HUMAN  = {30, 2.0/3.0, 20, 1.0/2.0, 60, 100};
-
-/// Elf: High attack and perfect attackChance; low defence.
-constexpr RaceStats ELF    = {40, 1.0,     10, 1.0/4.0, 40, 70};
-
-/// Dwarf: Robust defence and strength; strong survivability.
-constexpr RaceStats DWARF  = {30, 2.0/3.0, 20, 2.0/3.0, 50, 130};
-
-/// Hobbit: Low attack but high health; very defensive race.
-constexpr RaceStats HOBBIT = {25, 1.0/3.0, 20, 2.0/3.0, 70, 85};
-
-// ---------------------------------------------------------------------
-// Orc—Day/Night Variants
-// ---------------------------------------------------------------------
-
-/**
- * @brief Orc stats during daytime.
- *
- * Orcs are weaker during the day per game rules:
- *  - Lower attack and defence
- *  - Much lower attackChance and defenceChance
- */
-constexpr RaceStats ORC_DAY   = {25, 1.0/4.0, 10, 1.0/4.0, 50, 130};
-
-/**
- * @brief Orc stats during nighttime.
- *
- * Orcs become extremely strong during night:
- *  - Very high attack and defence values
- *  - Improved attackChance and defenceChance
- */
-constexpr RaceStats ORC_NIGHT = {45, 1.0,    25, 1.0/2.0, 50, 130};
-
-} // namespace Constants
-
-#endif // CONSTANTS_H
+/**
+ * @file Constants.h
+ * @brief Defines global constants and race stat templates used throughout the game.
+ *
+ * This header provides:
+ *  - The number of commands required to toggle between day and night.
+ *  - The board size above which the world is generated lazily in chunks.
+ *  - The Race enum, whose values are the race codes (e.g. in save files).
+ *  - A RaceStats struct describing the combat and survival attributes for each race.
+ *  - Day and night RaceStats tables for all player and enemy races, indexed
+ *    by race code.
+ *  - A RaceTraits table with each race's successful-defence reaction.
+ *
+ * The race tables are generated at compile time from GameData.def, which holds
+ * all core balance parameters; character construction is a single table index.
+ */
+
+#ifndef CONSTANTS_H
+#define CONSTANTS_H
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @namespace Constants
+ * @brief Contains global constant values and race templates used by Characters.
+ *
+ * All race attributes (attack, defence, health, strength, etc.)
+ * are stored in constexpr tables built from GameData.def and referenced when
+ * initializing Player or Enemy instances. This provides a clean separation
+ * between game logic and character configuration.
+ */
+namespace Constants {
+
+/// Number of player commands required to trigger day/night change.
+constexpr int COMMANDS_PER_TIME_SWITCH = 5;
+
+/// Boards with more squares than this are created in BoardMode::CHUNKED.
+constexpr long long MAX_DENSE_SQUARES = 16LL * 1024 * 1024;
+
+/// Largest width or height of any board; keeps chunk and square indices within range.
+constexpr int MAX_BOARD_SIDE = 1 << 20;
+
+/// Rounds after which a fight fought to the end is broken off (neither side can win it).
+constexpr int MAX_FIGHT_ROUNDS = 1000;
+
+/// Default file used by the save (V) command and offered for loading at start-up.
+constexpr const char *SAVE_FILE_NAME = "savegame.fbg";
+
+/**
+ * @enum Race
+ * @brief Every race, in GameData.def order; the enumerator value is the race code.
+ */
+enum class Race : std::uint8_t {
+#define RACE(id, ...) id,
+#include "GameData.def"
+};
+
+/// Race names, indexed by race code (e.g. in save files).
+constexpr std::string_view RACE_NAMES[] = {
+#define RACE(id, name, ...) name,
+#include "GameData.def"
+};
+
+/// Number of races.
+constexpr int RACE_COUNT = static_cast<int>(sizeof(RACE_NAMES) / sizeof(RACE_NAMES[0]));
+
+/// Enemy display names, indexed by race code; interned so describing a square copies no strings.
+constexpr std::string_view ENEMY_NAMES[RACE_COUNT] = {
+#define RACE(id, name, ...) name " (Enemy)",
+#include "GameData.def"
+};
+
+/// Player display names, indexed by race code; like ENEMY_NAMES, built at compile time.
+constexpr std::string_view PLAYER_NAMES[RACE_COUNT] = {
+#define RACE(id, name, ...) "Player(" name ")",
+#include "GameData.def"
+};
+
+/**
+ * @brief Looks up the race code of a race name.
+ * @param name Race name, e.g. "Dwarf".
+ * @return Index into RACE_NAMES, or -1 if the name is not a race.
+ */
+inline int raceIndex(std::string_view name) {
+    for (int i = 0; i < RACE_COUNT; ++i) {
+        if (RACE_NAMES[i] == name) return i;
+    }
+    return -1;
+}
+
+/**
+ * @struct RaceStats
+ * @brief Container for all base statistics of a game race.
+ *
+ * Each field corresponds to an attribute used during combat or inventory
+ * calculations, and is applied when constructing Characters.
+ *
+ * Fields:
+ *  - attack: Base attack value
+ *  - attackChance: Probability [0–1] of successful attack
+ *  - defence: Base defence value
+ *  - defenceChance: Probability [0–1] of successful defence
+ *  - health: Starting health
+ *  - strength: Weight capacity used for inventory limits
+ */
+struct RaceStats {
+    int attack;
+    double attackChance;
+    int defence;
+    double defenceChance;
+    int health;
+    int strength;
+};
+
+/// Daytime stats of every race, indexed by race code.
+constexpr RaceStats RACE_STATS[RACE_COUNT] = {
+#define RACE(id, name, attack, attackChance, defence, defenceChance, health, strength) \
+    {attack, attackChance, defence, defenceChance, health, strength},
+#include "GameData.def"
+};
+
+/**
+ * @brief Builds the night-time stat table: daytime stats, overridden by NIGHT_STATS entries.
+ * @return Night stats of every race, indexed by race code.
+ */
+constexpr std::array<RaceStats, RACE_COUNT> makeNightStats() {
+    std::array<RaceStats, RACE_COUNT> table{};
+    for (int i = 0; i < RACE_COUNT; ++i) table[i] = RACE_STATS[i];
+#define NIGHT_STATS(id, attack, attackChance, defence, defenceChance, health, strength) \
+    table[static_cast<int>(Race::id)] = RaceStats{attack, attackChance, defence, defenceChance, health, strength};
+#include "GameData.def"
+    return table;
+}
+
+/// Night-time stats of every race, indexed by race code.
+constexpr std::array<RaceStats, RACE_COUNT> RACE_NIGHT_STATS = makeNightStats();
+
+/**
+ * @brief Builds the per-race flag telling whether a race has NIGHT_STATS.
+ * @return Flags indexed by race code.
+ */
+constexpr std::array<bool, RACE_COUNT> makeNightFlags() {
+    std::array<bool, RACE_COUNT> flags{};
+#define NIGHT_STATS(id, ...) flags[static_cast<int>(Race::id)] = true;
+#include "GameData.def"
+    return flags;
+}
+
+/// Whether a race changes stats at night, indexed by race code.
+constexpr std::array<bool, RACE_COUNT> CHANGES_AT_NIGHT = makeNightFlags();
+
+/**
+ * @brief Returns the stat line of a race at the given time of day.
+ * @param raceCode Index into RACE_NAMES (must be valid).
+ * @param night True at night (only races with NIGHT_STATS change).
+ * @return The race's stats.
+ */
+constexpr const RaceStats &raceStats(int raceCode, bool night) {
+    return night ? RACE_NIGHT_STATS[raceCode] : RACE_STATS[raceCode];
+}
+
+/// @copydoc raceStats(int, bool)
+constexpr const RaceStats &raceStats(Race race, bool night) {
+    return raceStats(static_cast<int>(race), night);
+}
+
+/**
+ * @enum DefenceReaction
+ * @brief What a character does after successfully defending an attack.
+ *
+ *  - NONE:          nothing; the attack is fully blocked.
+ *  - HEAL:          regains 1 health.
+ *  - RANDOM_DAMAGE: takes a random 0-5 damage itself.
+ *  - COUNTER:       takes a quarter of its base attack minus base defence itself.
+ *
+ * The damage of RANDOM_DAMAGE and COUNTER lands on the defender, not on the
+ * attacker: Character::resolveAttack() subtracts it from the target, exactly
+ * as the original Character::attack() did.
+ */
+enum class DefenceReaction : std::uint8_t { NONE, HEAL, RANDOM_DAMAGE, COUNTER };
+
+/**
+ * @struct RaceTraits
+ * @brief Per-race behaviour that is not a stat: the defence reaction by day and by night.
+ */
+struct RaceTraits {
+    DefenceReaction dayDefence;
+    DefenceReaction nightDefence;
+};
+
+/**
+ * @brief Builds the traits table: no reaction, overridden by DEFENCE entries.
+ * @return Traits of every race, indexed by race code.
+ */
+constexpr std::array<RaceTraits, RACE_COUNT> makeRaceTraits() {
+    std::array<RaceTraits, RACE_COUNT> table{};
+#define DEFENCE(id, day, night) \
+    table[static_cast<int>(Race::id)] = RaceTraits{DefenceReaction::day, DefenceReaction::night};
+#include "GameData.def"
+    return table;
+}
+
+/// Behaviour traits of every race, indexed by race code.
+constexpr std::array<RaceTraits, RACE_COUNT> RACE_TRAITS = makeRaceTraits();
+
+/**
+ * @brief Returns how a race reacts to a successful defence at the given time of day.
+ * @param race Race.
+ * @param night True at night.
+ * @return The reaction.
+ */
+constexpr DefenceReaction defenceReaction(Race race, bool night) {
+    const RaceTraits &traits = RACE_TRAITS[static_cast<int>(race)];
+    return night ? traits.nightDefence : traits.dayDefence;
+}
+
+} // namespace Constants
+
+#endif // CONSTANTS_H
@@ -0,0 +1,53 @@
+# Game sources shared by the game itself and the targets under tests/ and bench/.
+# Paths are relative to this file so that projects in other directories can include it.
+
+INCLUDEPATH += $$PWD
+
+# Store dense boards in 64x64 Z-order (Morton) tiles instead of rows.
+# DEFINES += FBG_MORTON_LAYOUT
+
+SOURCES += \
+        $$PWD/BalanceSimulator.cpp \
+        $$PWD/Board.cpp \
+        $$PWD/BoardSquare.cpp \
+        $$PWD/Character.cpp \
+        $$PWD/CombatEventSink.cpp \
+        $$PWD/CombatOdds.cpp \
+        $$PWD/Enemy.cpp \
+        $$PWD/ItemFactory.cpp \
+        $$PWD/LoadoutOptimiser.cpp \
+        $$PWD/OccupantPool.cpp \
+        $$PWD/Player.cpp \
+        $$PWD/SaveGame.cpp \
+        $$PWD/Utility.cpp \
+        $$PWD/WorldTemplate.cpp
+
+HEADERS += \
+    $$PWD/Armour.h \
+    $$PWD/BalanceSimulator.h \
+    $$PWD/BinaryIO.h \
+    $$PWD/Board.h \
+    $$PWD/BoardSquare.h \
+    $$PWD/Character.h \
+    $$PWD/CombatEventSink.h \
+    $$PWD/CombatOdds.h \
+    $$PWD/Constants.h \
+    $$PWD/Enemy.h \
+    $$PWD/Item.h \
+    $$PWD/ItemFactory.h \
+    $$PWD/LoadoutOptimiser.h \
+    $$PWD/Occupancy.h \
+    $$PWD/OccupantPool.h \
+    $$PWD/Player.h \
+    $$PWD/Ring.h \
+    $$PWD/SaveGame.h \
+    $$PWD/Shield.h \
+    $$PWD/SlabArena.h \
+    $$PWD/SquareGrid.h \
+    $$PWD/Utility.h \
+    $$PWD/Weapon.h \
+    $$PWD/WorldTemplate.h
+
+# Race and item balance data, expanded into the tables of Constants.h and ItemFactory.
+DISTFILES += \
+    $$PWD/GameData.def
@@ -1,134 +1,124 @@
-/**
- * @file Item.h
- * @brief Declares the Item abstract base class and ItemType enumeration for all in-game items.
- *
- * Items represent all equippable or carriable objects in the game. They modify Character
- * statistics through applyEffect() and removeEffect(). All concrete items (Weapon, Armour,
- * Shield, Ring) derive from this class.
- *
- * Items are ALWAYS passed, stored, and transferred via std::unique_ptr<Item>, ensuring
- * exclusive ownership and preventing accidental sharing between characters or board squares.
- *
- * The Item class also provides the static factory createRandomItem(), used when the board
- * is populated randomly during initialization.
- */
-
-#ifndef ITEM_H
-#define ITEM_H
-
-#include <string>
-#include <memory>
-
-// Forward declaration prevents circular include with Character.h
-class Character;
-
-/**
- * @enum ItemType
- * @brief Enumerates the four required categories of equippable items.
- *
- * WEAPON  – Increases attack
- * ARMOUR  – Increases defence, may reduce attack
- * SHIELD  – Increases defence, may reduce attack
- * RING    – Special small items; player may carry multiple rings
- */
-enum class ItemType { WEAPON, ARMOUR, SHIELD, RING };
-
-/**
- * @class Item
- * @brief Abstract base class for all item types (Weapon, Armour, Shield, Ring).
- *
- * Responsibilities:
- *  - Store basic metadata (name, weight, type).
- *  - Apply and remove stat effects on a Character.
- *  - Allow Player inventory to store items via std::unique_ptr<Item>.
- *  - Provide Item::createRandomItem() factory for Board population.
- *
- * Assignment requirements satisfied:
- *  ✔ Abstract base class with virtual methods
- *  ✔ Dynamic and unbounded inventory via std::vector<std::unique_ptr<Item>>
- *  ✔ Items adjust stats through modifiers (apply/remove)
- *  ✔ Smart pointers used for memory safety
- */
-class Item {
-public:
-
-    /**
-     * @brief Constructs an Item with a given name, weight, and type.
-     *
-     * @param name   Human-readable name of the item.
-     * @param weight Weight added to player's carried load; compared to strength.
-     * @param type   Category of the item (weapon/armour/shield/ring).
-     */
-    Item(const std::string &name, int weight, ItemType type)
-        : name_(name), weight_(weight), type_(type) {}
-
-    virtual ~Item() = default;
-
-    // ---------------------------------------------------------------------
-    // Getters
-    // ---------------------------------------------------------------------
-
-    /// @return The display name of the item.
-    std::string getName() const { return name_; }
-
-    /// @return The weight of the item (used for carry capacity).
-    int getWeight() const { return weight_; }
-
-    /// @return The ItemType (used for pickup category restrictions).
-    ItemType getType() const { return type_; }
-
-    // ---------------------------------------------------------------------
-    // Core Abstract Behaviour
-    // ---------------------------------------------------------------------
-
-    /**
-     * @brief Applies this item's stat effects to a Character.
-     *
-     * Called when the Character successfully picks up the item.
-     *
-     * Examples:
-     *  - Weapon: increase attack
-     *  - Armour: increase defence, maybe decrease attack
-     *  - Shield: increase defence
-     *  - Ring: modify health or strength
-     *
-     * @param c Reference to Character receiving the effect.
-     */
-    virtual void applyEffect(Character &c) = 0;
-
-    /**
-     * @brief Removes this item's stat effects from a Character.
-     *
-     * Must reverse whatever applyEffect() did.
-     *
-     * @param c Reference to Character losing the effect.
-     */
-    virtual void removeEffect(Character &c) = 0;
-
-    // ---------------------------------------------------------------------
-    // Factory
-    // ---------------------------------------------------------------------
-
-    /**
-     * @brief Creates a random item instance using assignment rules.
-     *
-     * Used by Board::populateSquare() to randomly place items.
-     *
-     * PSEUDOCODE:
-     * 1. Generate random integer in range [0..3].
-     * 2. If 0 → return unique_ptr<Weapon>(Sword or Dagger).
-     * 3. If 1 → return unique_ptr<Armour>(Plate or Leather).
-     * 4. If 2 → return unique_ptr<Shield>(Large or Small).
-     * 5. If 3 → return unique_ptr<Ring>(RingOfLife or RingOfStrength).
-     *
-     * @return std::unique_ptr<Item> of a concrete item.
-     */
-    static std::unique_ptr<Item> createRandomItem();
-
-private:
-    std::string name_;  ///< The display name of the item.
-    int weight_;        ///< Weight used for strength-based carry limits.
-    ItemType type_;     ///< Category of item (weapon/armour/shield/ring).
-};
-
-#endif // ITEM_H
+/**
+ * @file Item.h
+ * @brief Declares the Item abstract base class and ItemType enumeration for all in-game items.
+ *
+ * Items represent all equippable or carriable objects in the game. Each one carries a
+ * plain StatModifiers line (attack, defence, health and strength deltas); a Character
+ * adds the lines of everything it carries to its base stats. All concrete items
+ * (Weapon, Armour, Shield, Ring) derive from this class and only choose their line.
+ *
+ * Items are immutable flyweights: ItemFactory owns exactly one instance of each
+ * predefined item, and board squares and inventories refer to it through a
+ * `const Item *`. Picking an item up or dropping it moves the reference, never
+ * the object, so no item is allocated or freed during play.
+ *
+ * Item stats are defined in GameData.def; ItemFactory builds the instances.
+ */
+
+#ifndef ITEM_H
+#define ITEM_H
+
+#include <string_view>
+#include "Utility.h"
+
+/**
+ * @enum ItemType
+ * @brief Enumerates the four required categories of equippable items.
+ *
+ * WEAPON  – Increases attack
+ * ARMOUR  – Increases defence, may reduce attack
+ * SHIELD  – Increases defence, may reduce attack
+ * RING    – Special small items; player may carry multiple rings
+ */
+enum class ItemType { WEAPON, ARMOUR, SHIELD, RING };
+
+/**
+ * @struct StatModifiers
+ * @brief Stat deltas contributed by an item (or by everything a Character carries).
+ *
+ * Modifiers only ever add up: a Character keeps the sum of the lines of all
+ * its items and derives its effective stats as base + sum. Removing an item
+ * subtracts exactly what adding it added, so equip/unequip always reverses.
+ */
+struct StatModifiers {
+    int attack = 0;   ///< Added to attack.
+    int defence = 0;  ///< Added to defence.
+    int health = 0;   ///< Added to health.
+    int strength = 0; ///< Added to strength (carry capacity).
+
+    /// Adds another line to this one.
+    StatModifiers &operator+=(const StatModifiers &o) {
+        attack += o.attack; defence += o.defence; health += o.health; strength += o.strength;
+        return *this;
+    }
+
+    /// Subtracts another line from this one.
+    StatModifiers &operator-=(const StatModifiers &o) {
+        attack -= o.attack; defence -= o.defence; health -= o.health; strength -= o.strength;
+        return *this;
+    }
+};
+
+/**
+ * @class Item
+ * @brief Base class for all item types (Weapon, Armour, Shield, Ring).
+ *
+ * Responsibilities:
+ *  - Store basic metadata (name, weight, type) and the stat modifiers.
+ *  - Allow Player inventory to store items via const Item * references.
+ *
+ * Only the concrete item classes can construct an Item. Equipping reads the
+ * modifiers directly, so there is no virtual dispatch on the equip path.
+ *
+ * Assignment requirements satisfied:
+ *  ✔ Polymorphic base class (virtual destructor) of the four item categories
+ *  ✔ Dynamic and unbounded inventory via std::vector<const Item *>
+ *  ✔ Items adjust stats through modifiers (added on pickup, subtracted on drop)
+ *  ✔ Shared, immutable instances owned by the ItemFactory catalogue
+ */
+class Item {
+public:
+
+    virtual ~Item() = default;
+
+    /// Items are shared by reference; copying one would break identity checks.
+    Item(const Item &) = delete;
+    Item &operator=(const Item &) = delete;
+
+    // ---------------------------------------------------------------------
+    // Getters
+    // ---------------------------------------------------------------------
+
+    /// @return The display name of the item (interned; no copy is made).
+    std::string_view getName() const { return name_; }
+
+    /// @return The weight of the item (used for carry capacity).
+    int getWeight() const { return weight_; }
+
+    /// @return The ItemType (used for pickup category restrictions).
+    ItemType getType() const { return type_; }
+
+    /// @return The stat deltas this item contributes while carried.
+    const StatModifiers &getModifiers() const { return modifiers_; }
+
+protected:
+
+    /**
+     * @brief Constructs an Item with a given name, weight, type and modifiers.
+     *
+     * @param name      Human-readable name of the item.
+     * @param weight    Weight added to player's carried load; compared to strength.
+     * @param type      Category of the item (weapon/armour/shield/ring).
+     * @param modifiers Stat deltas applied while the item is carried.
+     */
+    Item(std::string_view name, int weight, ItemType type, const StatModifiers &modifiers)
+        : name_(Utility::intern(name)), weight_(weight), type_(type), modifiers_(modifiers) {}
+
+private:
+    std::string_view name_; ///< The display name of the item (interned).
+    int weight_;        ///< Weight used for strength-based carry limits.
+    ItemType type_;     ///< Category of item (weapon/armour/shield/ring).
+    StatModifiers modifiers_; ///< Stat deltas applied while carried.
+};
+
+#endif // ITEM_H
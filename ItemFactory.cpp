@@ -1,40 +1,161 @@
-#include "ItemFactory.h"
-#include "Utility.h"
-#include "Weapon.h"
-#include "Armour.h"
-#include "Shield.h"
-#include "Ring.h"
-
-/**
- * @file ItemFactory.cpp
- * @brief Implements the ItemFactory class for creating random items.
- *
- * Responsibilities:
- *  - Provide a factory function to generate random items from a predefined list.
- */
-
-/**
- * @brief Creates a random item from a predefined set of items.
- *
- * Randomly selects one of eight items:
- *  - Weapon: Sword, Dagger
- *  - Armour: Plate Armour, Leather Armour
- *  - Shield: Large Shield, Small Shield
- *  - Ring: Ring of Life, Ring of Strength
- *
- * @return Unique pointer to the newly created Item, or nullptr if selection fails.
- */
-std::unique_ptr<Item> ItemFactory::createRandomItem() {
-    int choice = Utility::randInt(0, 7);
-    switch (choice) {
-    case 0: return std::make_unique<Weapon>("Sword", 10, 10);
-    case 1: return std::make_unique<Weapon>("Dagger", 5, 5);
-    case 2: return std::make_unique<Armour>("Plate Armour", 40, 10, 5);
-    case 3: return std::make_unique<Armour>("Leather Armour", 20, 5, 0);
-    case 4: return std::make_unique<Shield>("Large Shield", 30, 10, 5);
-    case 5: return std::make_unique<Shield>("Small Shield", 10, 5, 0);
-    case 6: return std::make_unique<Ring>("Ring of Life", 1, 10, 0);
-    case 7: return std::make_unique<Ring>("Ring of Strength", 1, -10, 50);
-    }
-    return nullptr;
-}
+#include "ItemFactory.h"
+#include "Utility.h"
+#include "Weapon.h"
+#include "Armour.h"
+#include "Shield.h"
+#include "Ring.h"
+#include <algorithm>
+#include <array>
+#include <memory>
+
+/**
+ * @file ItemFactory.cpp
+ * @brief Implements the ItemFactory item catalogue.
+ *
+ * Responsibilities:
+ *  - Build one immutable instance of each predefined item from ITEM_SPECS
+ *    (generated from GameData.def).
+ *  - Pick random catalogue items for board population.
+ *  - Map items to and from stable kind codes (used by squares and save files).
+ */
+
+/**
+ * @brief Stat line of one predefined item; the table index is its kind code.
+ *
+ * first/second are the constructor arguments after name and weight:
+ *  - Weapon: attack boost (second unused)
+ *  - Armour/Shield: defence boost, attack penalty
+ *  - Ring: health boost, strength boost
+ *
+ * The table itself is generated from the ITEM entries of GameData.def.
+ */
+struct ItemSpec {
+    const char *name;
+    ItemType type;
+    int weight;
+    int first;
+    int second;
+};
+
+static constexpr ItemSpec ITEM_SPECS[ItemFactory::ITEM_KIND_COUNT] = {
+#define ITEM(id, name, type, weight, first, second) {name, ItemType::type, weight, first, second},
+#include "GameData.def"
+};
+
+/**
+ * @brief Builds the catalogue instance described by one table entry.
+ * @param spec Table entry.
+ * @return The new item.
+ */
+static std::unique_ptr<const Item> makeItem(const ItemSpec &spec) {
+    switch (spec.type) {
+    case ItemType::WEAPON: return std::make_unique<const Weapon>(spec.name, spec.weight, spec.first);
+    case ItemType::ARMOUR: return std::make_unique<const Armour>(spec.name, spec.weight, spec.first, spec.second);
+    case ItemType::SHIELD: return std::make_unique<const Shield>(spec.name, spec.weight, spec.first, spec.second);
+    case ItemType::RING:   return std::make_unique<const Ring>(spec.name, spec.weight, spec.first, spec.second);
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Returns the catalogue: one shared, immutable instance per ITEM_SPECS entry.
+ *
+ * Built on first use (thread-safe), and lives until program exit.
+ */
+static const std::array<std::unique_ptr<const Item>, ItemFactory::ITEM_KIND_COUNT> &catalogue() {
+    static const auto items = [] {
+        std::array<std::unique_ptr<const Item>, ItemFactory::ITEM_KIND_COUNT> built;
+        for (int kind = 0; kind < ItemFactory::ITEM_KIND_COUNT; ++kind) built[kind] = makeItem(ITEM_SPECS[kind]);
+        return built;
+    }();
+    return items;
+}
+
+/**
+ * @brief Picks a random item from the catalogue.
+ *
+ * Randomly selects one of eight items:
+ *  - Weapon: Sword, Dagger
+ *  - Armour: Plate Armour, Leather Armour
+ *  - Shield: Large Shield, Small Shield
+ *  - Ring: Ring of Life, Ring of Strength
+ *
+ * @return The shared instance of the chosen item.
+ */
+const Item *ItemFactory::randomItem() {
+    return item(Utility::randInt(0, ITEM_KIND_COUNT - 1));
+}
+
+/**
+ * @brief Picks a random item from the catalogue, drawing from the given engine.
+ *
+ * @param gen Random engine to draw from.
+ * @return The shared instance of the chosen item.
+ */
+const Item *ItemFactory::randomItem(std::mt19937 &gen) {
+    return item(Utility::randInt(gen, 0, ITEM_KIND_COUNT - 1));
+}
+
+/**
+ * @brief Picks n random items, drawing all their kind codes in one pass.
+ *
+ * @param gen Random engine to draw from.
+ * @param n Number of items.
+ * @param out Receives the shared instances.
+ */
+void ItemFactory::generate(std::mt19937 &gen, size_t n, const Item **out) {
+    const auto &items = catalogue();
+    std::uint8_t kinds[256];
+    for (size_t done = 0; done < n; done += sizeof(kinds)) {
+        const size_t batch = std::min(n - done, sizeof(kinds));
+        Utility::randIntBatch(gen, 0, ITEM_KIND_COUNT - 1, kinds, batch);
+        for (size_t i = 0; i < batch; ++i) out[done + i] = items[kinds[i]].get();
+    }
+}
+
+/**
+ * @brief Returns the catalogue instance with the given kind code.
+ *
+ * @param kind Kind code in [0, ITEM_KIND_COUNT).
+ * @return The shared instance, or nullptr if kind is out of range.
+ */
+const Item *ItemFactory::item(int kind) {
+    if (kind < 0 || kind >= ITEM_KIND_COUNT) return nullptr;
+    return catalogue()[kind].get();
+}
+
+/**
+ * @brief Identifies a catalogue item by address.
+ *
+ * @param item Item to identify.
+ * @return Kind code, or -1 if the item is not a catalogue instance.
+ */
+int ItemFactory::kindOf(const Item &item) {
+    const auto &items = catalogue();
+    for (int kind = 0; kind < ITEM_KIND_COUNT; ++kind) {
+        if (items[kind].get() == &item) return kind;
+    }
+    return -1;
+}
+
+/**
+ * @brief Looks up the display name of an item kind in the item table.
+ *
+ * @param kind Kind code.
+ * @return The name, or an empty view for an unknown kind.
+ */
+std::string_view ItemFactory::nameOf(int kind) {
+    if (kind < 0 || kind >= ITEM_KIND_COUNT) return {};
+    return ITEM_SPECS[kind].name;
+}
+
+/**
+ * @brief Looks up the weight of an item kind in the item table.
+ *
+ * @param kind Kind code.
+ * @return The weight, or 0 for an unknown kind.
+ */
+int ItemFactory::weightOf(int kind) {
+    if (kind < 0 || kind >= ITEM_KIND_COUNT) return 0;
+    return ITEM_SPECS[kind].weight;
+}
@@ -1,67 +1,117 @@
-/**
- * @file ItemFactory.h
- * @brief Declares the ItemFactory class responsible for creating random items.
- *
- * The ItemFactory abstracts item generation logic from the Board and Item classes.
- * It returns std::unique_ptr<Item> objects representing any concrete item type
- * (Weapon, Armour, Shield, Ring).
- *
- * The factory may occasionally return nullptr depending on game rules—this allows
- * Board generation to include empty squares.
- */
-
-#ifndef ITEMFACTORY_H
-#define ITEMFACTORY_H
-
-#include <memory>
-#include "Item.h"
-
-// Forward declarations of concrete item types.
-// Definitions are in their respective headers.
-class Weapon;
-class Armour;
-class Shield;
-class Ring;
-
-/**
- * @class ItemFactory
- * @brief Provides static factory methods for creating concrete Item instances.
- *
- * Responsibilities:
- *  - Centralize the logic for generating random items.
- *  - Encapsulate item creation so that Board does not depend on
- *    all concrete item subclasses directly.
- *  - Ensure all returned items are managed through std::unique_ptr<Item>.
- *
- * This satisfies assignment requirements for:
- *  - Random item placement
- *  - Smart pointer ownership
- *  - Abstract factory pattern for item generation
- */
-class ItemFactory {
-public:
-
-    /**
-     * @brief Creates a random item instance based on game rules.
-     *
-     * May return nullptr to represent "no item" probability during board population.
-     *
-     * PSEUDOCODE:
-     *  1. Generate random number R in allowed range.
-     *  2. If R corresponds to "no item":
-     *         return nullptr.
-     *  3. If R corresponds to a Weapon:
-     *         return std::make_unique<Weapon>(...).
-     *  4. If R corresponds to Armour:
-     *         return std::make_unique<Armour>(...).
-     *  5. If R corresponds to a Shield:
-     *         return std::make_unique<Shield>(...).
-     *  6. If R corresponds to a Ring:
-     *         return std::make_unique<Ring>(...).
-     *
-     * @return A unique_ptr to a newly created Item (or nullptr).
-     */
-    static std::unique_ptr<Item> createRandomItem();
-};
-
-#endif // ITEMFACTORY_H
+/**
+ * @file ItemFactory.h
+ * @brief Declares the ItemFactory class, the catalogue of every item in the game.
+ *
+ * The ItemFactory owns one immutable instance (prototype) of each predefined
+ * item — name, weight, type and stat modifiers — and hands out `const Item *`
+ * references to them. Board squares and inventories store those references
+ * (or the equivalent kind codes) instead of allocating items of their own, so
+ * populating a board performs no per-item allocation or string copying.
+ */
+
+#ifndef ITEMFACTORY_H
+#define ITEMFACTORY_H
+
+#include <cstdint>
+#include <string_view>
+#include <random>
+#include "Item.h"
+
+/**
+ * @enum ItemKind
+ * @brief Every predefined item, in GameData.def order; the enumerator value is the kind code.
+ */
+enum class ItemKind : std::uint8_t {
+#define ITEM(id, ...) id,
+#include "GameData.def"
+};
+
+/**
+ * @class ItemFactory
+ * @brief Static catalogue of the predefined items.
+ *
+ * Responsibilities:
+ *  - Own the single shared instance of each item kind.
+ *  - Map between items and stable kind codes (used by squares and save files).
+ *  - Pick random items for board population.
+ *
+ * This satisfies assignment requirements for:
+ *  - Random item placement
+ *  - Abstract factory pattern for item generation
+ */
+class ItemFactory {
+public:
+
+    /// Number of distinct item kinds in the catalogue (kind codes 0..ITEM_KIND_COUNT-1).
+    static constexpr int ITEM_KIND_COUNT = 0
+#define ITEM(id, ...) + 1
+#include "GameData.def"
+        ;
+
+    /**
+     * @brief Picks a random item from the catalogue.
+     *
+     * PSEUDOCODE:
+     *  1. kind = random integer in [0, ITEM_KIND_COUNT).
+     *  2. return item(kind).
+     *
+     * @return The shared instance of the chosen item (never null).
+     */
+    static const Item *randomItem();
+
+    /**
+     * @brief Picks a random item, drawing from the given engine.
+     *
+     * Same catalogue as randomItem(), but reproducible: used by seeded world
+     * generation so that a chunk's contents depend only on its seed.
+     *
+     * @param gen Random engine to draw the item choice from.
+     * @return The shared instance of the chosen item (never null).
+     */
+    static const Item *randomItem(std::mt19937 &gen);
+
+    /**
+     * @brief Picks n random items in one batch, drawing from the given engine.
+     *
+     * All kind codes are drawn in one pass (Utility::randIntBatch) and then
+     * mapped to catalogue instances; used when populating a whole chunk.
+     *
+     * @param gen Random engine to draw from.
+     * @param n Number of items.
+     * @param out Receives n shared instances (never null).
+     */
+    static void generate(std::mt19937 &gen, size_t n, const Item **out);
+
+    /**
+     * @brief Returns the catalogue instance of an item kind.
+     * @param kind Kind code in [0, ITEM_KIND_COUNT).
+     * @return The shared instance, or nullptr if kind is out of range.
+     */
+    static const Item *item(int kind);
+
+    /// @copydoc item(int)
+    static const Item *item(ItemKind kind) { return item(static_cast<int>(kind)); }
+
+    /**
+     * @brief Returns the kind code of a catalogue item.
+     * @param item Item to identify.
+     * @return Kind code in [0, ITEM_KIND_COUNT), or -1 if the item is not from the catalogue.
+     */
+    static int kindOf(const Item &item);
+
+    /**
+     * @brief Returns the display name of an item kind.
+     * @param kind Kind code in [0, ITEM_KIND_COUNT).
+     * @return The name, or an empty view if kind is out of range.
+     */
+    static std::string_view nameOf(int kind);
+
+    /**
+     * @brief Returns the weight of an item kind.
+     * @param kind Kind code in [0, ITEM_KIND_COUNT).
+     * @return The weight, or 0 if kind is out of range.
+     */
+    static int weightOf(int kind);
+};
+
+#endif // ITEMFACTORY_H
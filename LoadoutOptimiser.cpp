@@ -0,0 +1,189 @@
+#include "LoadoutOptimiser.h"
+#include "Character.h"
+#include "ItemFactory.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @file LoadoutOptimiser.cpp
+ * @brief Implements the loadout knapsack.
+ *
+ * Responsibilities:
+ *  - Reduce the item pool to counts per catalogue kind.
+ *  - Turn the counts into knapsack stages (equipment groups, binary ring chunks).
+ *  - Run the DP over the strength budget and rebuild the chosen items.
+ */
+
+/**
+ * @brief One way to fill a stage: a number of copies of one item kind.
+ */
+struct StageOption {
+    int kind;     ///< Catalogue kind.
+    int copies;   ///< How many of it the option takes.
+    int cost;     ///< copies * (weight - strength modifier).
+    int weight;   ///< copies * weight.
+    double value; ///< copies * objective score.
+};
+
+/// A knapsack stage: take at most one of its options.
+using Stage = std::vector<StageOption>;
+
+/**
+ * @brief Weights attack by the chance that self's attack lands on target.
+ * @param self Character choosing a loadout.
+ * @param target Opponent.
+ * @return The objective.
+ */
+LoadoutOptimiser::Objective LoadoutOptimiser::Objective::expectedDamage(const Character &self,
+                                                                        const Character &target)
+{
+    Objective o;
+    o.attack = self.getAttackChance() * (1.0 - target.getDefenceChance());
+    return o;
+}
+
+/**
+ * @brief Adds to expectedDamage() a defence weight: the chance that target's attack lands on self.
+ * @param self Character choosing a loadout.
+ * @param target Opponent.
+ * @return The objective.
+ */
+LoadoutOptimiser::Objective LoadoutOptimiser::Objective::damageMargin(const Character &self,
+                                                                      const Character &target)
+{
+    Objective o = expectedDamage(self, target);
+    o.defence = target.getAttackChance() * (1.0 - self.getDefenceChance());
+    return o;
+}
+
+/**
+ * @brief Makes the option of taking some copies of one kind.
+ * @param kind Catalogue kind.
+ * @param copies Number of copies.
+ * @param objective Scores the kind's modifiers.
+ * @return The option.
+ */
+static StageOption makeOption(int kind, int copies, const LoadoutOptimiser::Objective &objective)
+{
+    const Item *item = ItemFactory::item(kind);
+    const int cost = item->getWeight() - item->getModifiers().strength;
+    return {kind, copies, copies * cost, copies * item->getWeight(), copies * objective.score(item->getModifiers())};
+}
+
+/**
+ * @brief Finds the best loadout (see header for the algorithm).
+ *
+ * DP state index i stands for a summed cost of lo + i. Costs can be
+ * negative (strength rings), so the range reaches down to the most negative
+ * total, lo, and up to cap - lo: anything above that can never come back
+ * within cap.
+ */
+LoadoutOptimiser::Loadout LoadoutOptimiser::best(const Character &character,
+                                                 const std::vector<const Item*> &candidates,
+                                                 const Objective &objective)
+{
+    // 1. Pool counts per kind
+    std::array<int, ItemFactory::ITEM_KIND_COUNT> counts{};
+    for (size_t i = 0; i < character.inventorySize(); ++i) {
+        const InventoryEntry entry = character.inventoryEntry(i);
+        const int kind = ItemFactory::kindOf(*entry.item);
+        if (kind >= 0) counts[kind] += entry.count;
+    }
+    for (const Item *item : candidates) {
+        const int kind = item ? ItemFactory::kindOf(*item) : -1;
+        if (kind >= 0) ++counts[kind];
+    }
+
+    // Keep health-lowering rings from taking health to 0
+    int healthToSpare = character.getHealth() - character.getModifiers().health - 1;
+    for (int kind = 0; kind < ItemFactory::ITEM_KIND_COUNT; ++kind) {
+        const Item *item = ItemFactory::item(kind);
+        const int loss = -item->getModifiers().health;
+        if (item->getType() != ItemType::RING || loss <= 0) continue;
+        counts[kind] = std::min(counts[kind], std::max(healthToSpare, 0) / loss);
+        healthToSpare -= counts[kind] * loss;
+    }
+
+    // 2. Stages
+    std::vector<Stage> stages;
+    for (ItemType type : {ItemType::WEAPON, ItemType::ARMOUR, ItemType::SHIELD}) {
+        Stage group;
+        for (int kind = 0; kind < ItemFactory::ITEM_KIND_COUNT; ++kind) {
+            if (counts[kind] > 0 && ItemFactory::item(kind)->getType() == type) {
+                group.push_back(makeOption(kind, 1, objective));
+            }
+        }
+        if (!group.empty()) stages.push_back(std::move(group));
+    }
+    for (int kind = 0; kind < ItemFactory::ITEM_KIND_COUNT; ++kind) {
+        if (ItemFactory::item(kind)->getType() != ItemType::RING) continue;
+        for (int left = counts[kind], chunk = 1; left > 0; left -= chunk, chunk *= 2) {
+            stages.push_back({makeOption(kind, std::min(chunk, left), objective)});
+        }
+    }
+
+    // 3. DP over summed cost
+    const int cap = character.getBaseStats().strength;
+    int lo = 0;
+    for (const Stage &stage : stages) {
+        int cheapest = 0;
+        for (const StageOption &o : stage) cheapest = std::min(cheapest, o.cost);
+        lo += cheapest;
+    }
+    const int range = cap - 2 * lo + 1;
+    if (range <= 0) return {};
+
+    constexpr double UNREACHED = -std::numeric_limits<double>::infinity();
+    std::vector<double> value(range, UNREACHED), next;
+    std::vector<int> weight(range, 0), nextWeight;          // weight of the best set per state
+    std::vector<std::uint8_t> taken(stages.size() * range, 0); // option index + 1, per stage and state
+    value[-lo] = 0.0;
+    for (size_t s = 0; s < stages.size(); ++s) {
+        next = value;
+        nextWeight = weight;
+        std::uint8_t *choice = &taken[s * range];
+        for (size_t o = 0; o < stages[s].size(); ++o) {
+            const StageOption &opt = stages[s][o];
+            const int from = std::max(0, -opt.cost), to = std::min(range, range - opt.cost);
+            for (int i = from; i < to; ++i) {
+                if (value[i] == UNREACHED) continue;
+                const int j = i + opt.cost;
+                const double v = value[i] + opt.value;
+                const int w = weight[i] + opt.weight;
+                if (v > next[j] || (v == next[j] && w < nextWeight[j])) {
+                    next[j] = v;
+                    nextWeight[j] = w;
+                    choice[j] = static_cast<std::uint8_t>(o + 1);
+                }
+            }
+        }
+        value.swap(next);
+        weight.swap(nextWeight);
+    }
+
+    // 4. Best fitting state (lightest on ties), then walk back
+    int bestState = -1;
+    for (int i = 0; i <= cap - lo; ++i) {
+        if (value[i] == UNREACHED) continue;
+        if (bestState < 0 || value[i] > value[bestState]
+            || (value[i] == value[bestState] && weight[i] < weight[bestState])) bestState = i;
+    }
+    Loadout result;
+    if (bestState < 0) return result;
+    result.score = value[bestState];
+    for (size_t s = stages.size(); s-- > 0;) {
+        const std::uint8_t o = taken[s * range + bestState];
+        if (!o) continue;
+        const StageOption &opt = stages[s][o - 1];
+        const Item *item = ItemFactory::item(opt.kind);
+        for (int c = 0; c < opt.copies; ++c) {
+            result.items.push_back(item);
+            result.modifiers += item->getModifiers();
+            result.weight += item->getWeight();
+        }
+        bestState -= opt.cost;
+    }
+    return result;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file LoadoutOptimiser.h
+ * @brief Declares LoadoutOptimiser, which picks the best set of items to carry.
+ *
+ * Given a Character and some candidate items (for example every item within
+ * a radius on the Board, found with Board::occupantsWithinRadius and
+ * Board::recordAt), the optimiser chooses which of those items and the
+ * character's own inventory to carry so that an Objective is maximised,
+ * subject to the same rules as Character::pickUp:
+ *  - at most one weapon, one armour and one shield;
+ *  - any number of rings;
+ *  - total weight within strength, where strength includes the strength
+ *    modifiers of the chosen items themselves.
+ *
+ * The choice is a grouped 0/1 knapsack solved by dynamic programming over
+ * the strength budget, so the cost grows with the number of item kinds and
+ * the log of how many rings of each kind there are, not with 2^items.
+ */
+
+#ifndef LOADOUTOPTIMISER_H
+#define LOADOUTOPTIMISER_H
+
+#include <vector>
+#include "Item.h"
+
+class Character;
+
+/**
+ * @class LoadoutOptimiser
+ * @brief Static knapsack solver for the best equipment set under a strength budget.
+ *
+ * Design:
+ *  - All functions are static.
+ *  - No instances are allowed (constructor is deleted).
+ */
+class LoadoutOptimiser {
+public:
+
+    /**
+     * @struct Objective
+     * @brief Linear score of a loadout: a weight per stat modifier.
+     *
+     * The score of a loadout is the weighted sum of its summed StatModifiers.
+     * Keeping it linear makes the value of a set the sum of its items'
+     * values, which is what lets the knapsack be solved exactly.
+     */
+    struct Objective {
+        double attack = 0.0;   ///< Score per point of attack.
+        double defence = 0.0;  ///< Score per point of defence.
+        double health = 0.0;   ///< Score per point of health.
+        double strength = 0.0; ///< Score per point of strength.
+
+        /// @return The score of a modifier line.
+        double score(const StatModifiers &m) const {
+            return attack * m.attack + defence * m.defence + health * m.health + strength * m.strength;
+        }
+
+        /**
+         * @brief Expected damage self deals to target per round.
+         *
+         * A hit lands with probability attackChance * (1 - target defenceChance)
+         * and then deals attack - target defence, so each point of attack is
+         * worth that probability. Special defences and the clamp at zero
+         * damage are not modelled.
+         *
+         * @param self Character choosing a loadout.
+         * @param target Opponent.
+         * @return The objective.
+         */
+        static Objective expectedDamage(const Character &self, const Character &target);
+
+        /**
+         * @brief Expected damage dealt minus expected damage taken per round.
+         *
+         * As expectedDamage(), plus each point of defence is worth the chance
+         * that target's attack lands on self.
+         *
+         * @param self Character choosing a loadout.
+         * @param target Opponent.
+         * @return The objective.
+         */
+        static Objective damageMargin(const Character &self, const Character &target);
+    };
+
+    /**
+     * @struct Loadout
+     * @brief A chosen set of items and what carrying it amounts to.
+     */
+    struct Loadout {
+        std::vector<const Item*> items; ///< Items to carry; a ring appears once per copy.
+        StatModifiers modifiers;        ///< Sum of the items' modifiers.
+        int weight = 0;                 ///< Total weight of the items.
+        double score = 0.0;             ///< Objective score of modifiers.
+    };
+
+    /**
+     * @brief Finds the loadout that maximises an objective.
+     *
+     * The pool is the character's current inventory plus the candidates.
+     *
+     * PSEUDOCODE:
+     * 1. Count the pool per catalogue kind.
+     * 2. Build stages: one per equipment category (take none or one kind),
+     *    and per ring kind one stage per binary chunk 1, 2, 4, ... of its count.
+     * 3. An option costs weight - strength modifier; rings of strength cost
+     *    less than nothing. DP over the summed cost (bounded by the base
+     *    strength), keeping the best score (then lowest weight) and the
+     *    option taken per stage.
+     * 4. Take the best state whose cost fits; walk the choices back.
+     *
+     * Rings that lower health are limited so that, ignoring other rings,
+     * the character's health stays above 0.
+     *
+     * @param character Character whose base stats and inventory are used.
+     * @param candidates Extra catalogue items that could be picked up.
+     * @param objective What to maximise.
+     * @return The best loadout; ties go to the lightest one.
+     */
+    static Loadout best(const Character &character, const std::vector<const Item*> &candidates,
+                        const Objective &objective);
+
+private:
+    /// Private constructor to prevent instantiation
+    LoadoutOptimiser() = delete;
+};
+
+#endif // LOADOUTOPTIMISER_H
@@ -0,0 +1,40 @@
+#include "OccupantPool.h"
+#include "Constants.h"
+#include "Utility.h"
+#include <algorithm>
+
+/**
+ * @file OccupantPool.cpp
+ * @brief Implements enemy construction (single and batched) for OccupantPool.
+ */
+
+/**
+ * @brief Constructs an enemy of the given race in the first free slot.
+ * @param raceCode Race code.
+ * @return Slot id.
+ */
+std::uint32_t OccupantPool::addEnemy(int raceCode)
+{
+    return enemies_.emplace(raceCode);
+}
+
+/**
+ * @brief Constructs n enemies of random races, drawing all race codes in one pass.
+ * @param gen Random engine.
+ * @param n Number of enemies.
+ * @param ids Receives the slot ids.
+ */
+void OccupantPool::generateEnemies(std::mt19937 &gen, size_t n, std::uint32_t *ids)
+{
+    const bool night = Utility::isNight();
+    std::uint8_t races[256];
+    for (size_t done = 0; done < n; done += sizeof(races)) {
+        const size_t batch = std::min(n - done, sizeof(races));
+        Utility::randIntBatch(gen, 0, Constants::RACE_COUNT - 1, races, batch);
+        for (size_t i = 0; i < batch; ++i) {
+            const std::uint32_t id = enemies_.emplace(static_cast<int>(races[i]));
+            if (night) enemies_[id].updateForTime(true);
+            ids[done + i] = id;
+        }
+    }
+}
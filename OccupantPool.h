@@ -0,0 +1,107 @@
+/**
+ * @file OccupantPool.h
+ * @brief Declares OccupantPool, the Board-owned storage of the enemies on its squares.
+ *
+ * BoardSquares do not own their occupants. Each square holds a small tagged
+ * id: an enemy id indexes a slot in an OccupantPool, while an item id is the
+ * item's kind code in the shared ItemFactory catalogue and needs no storage.
+ *
+ * The Board keeps one pool per chunk (so chunks can be populated on separate
+ * threads without locking) and a single pool for a template board's overlay.
+ * Enemies are constructed in place inside the pool's SlabArena, so spawning
+ * one performs no heap allocation of its own, and destroying a pool (or the
+ * Board holding it) releases its enemies a whole slab at a time. Freed slots
+ * are recycled, so a pool never holds more slots than the peak number of
+ * occupants it has held at once.
+ *
+ * Code outside the Board refers to enemies through EnemyHandles: 32-bit
+ * generational handles that resolve in O(1) and come back nullptr once the
+ * enemy has been destroyed, even if its slot holds a new enemy by then.
+ */
+
+#ifndef OCCUPANTPOOL_H
+#define OCCUPANTPOOL_H
+
+#include <cstdint>
+#include <random>
+#include "Enemy.h"
+#include "SlabArena.h"
+
+/// Generational reference to an enemy in an OccupantPool.
+using EnemyHandle = SlotHandle;
+
+/**
+ * @class OccupantPool
+ * @brief Slot storage for enemies, addressed by 30-bit ids.
+ *
+ * PSEUDOCODE:
+ *  addEnemy(race):   id = enemies_.emplace(race); return id
+ *  generateEnemies(n): draw n races; addEnemy each
+ *  enemy(id):        return enemies_[id]
+ *  releaseEnemy(id): enemies_.erase(id)
+ *  resolve(handle):  enemies_.find(handle)
+ *
+ * The pool owns everything it holds; destroying it destroys its occupants.
+ */
+class OccupantPool {
+public:
+
+    /// Largest id a square can store.
+    static constexpr std::uint32_t MAX_ID = (1u << 30) - 1;
+
+    /**
+     * @brief Constructs an enemy in the pool.
+     * @param raceCode Index into Constants::RACE_NAMES. @pre 0 <= raceCode < RACE_COUNT
+     * @return Id of the slot now holding it.
+     */
+    std::uint32_t addEnemy(int raceCode);
+
+    /**
+     * @brief Constructs n random enemies in one batch.
+     *
+     * All race codes are drawn in one pass (Utility::randIntBatch), then the
+     * enemies are constructed back to back in the arena, adjusted for the
+     * current time of day.
+     *
+     * @param gen Random engine to draw the races from.
+     * @param n Number of enemies.
+     * @param ids Receives the n slot ids, in construction order.
+     */
+    void generateEnemies(std::mt19937 &gen, size_t n, std::uint32_t *ids);
+
+    /// @return The enemy in slot id. @pre id was returned by addEnemy() and not released.
+    Enemy *enemy(std::uint32_t id) { return &enemies_[id]; }
+
+    /// @copydoc enemy(std::uint32_t)
+    const Enemy *enemy(std::uint32_t id) const { return &enemies_[id]; }
+
+    /// @return A handle to the enemy in slot id. @pre id is live.
+    EnemyHandle handleOf(std::uint32_t id) const { return enemies_.handle(id); }
+
+    /**
+     * @brief Resolves an enemy handle.
+     * @param handle Handle from handleOf().
+     * @return The enemy, or nullptr if the handle is null or stale.
+     */
+    Enemy *resolve(EnemyHandle handle) { return enemies_.find(handle); }
+
+    /// @copydoc resolve(EnemyHandle)
+    const Enemy *resolve(EnemyHandle handle) const { return enemies_.find(handle); }
+
+    /**
+     * @brief Destroys an enemy and frees its slot.
+     *
+     * Handles to the enemy go stale.
+     *
+     * @param id Slot to release.
+     */
+    void releaseEnemy(std::uint32_t id) { enemies_.erase(id); }
+
+    /// @return Number of enemies in the pool.
+    size_t enemyCount() const { return enemies_.size(); }
+
+private:
+    SlabArena<Enemy> enemies_; ///< Enemies, constructed in place.
+};
+
+#endif // OCCUPANTPOOL_H
@@ -0,0 +1,77 @@
+#include "SaveGame.h"
+#include "Board.h"
+#include "Player.h"
+#include "Utility.h"
+#include "BinaryIO.h"
+#include <algorithm>
+#include <fstream>
+
+/**
+ * @file SaveGame.cpp
+ * @brief Implements binary save and load of the whole game state.
+ *
+ * Responsibilities:
+ *  - Write and validate the file header (magic, version, day/night flag).
+ *  - Delegate the Board and Player sections to Board::save/load and Player::save/load.
+ */
+
+/// File signature at the start of every save.
+static const char SAVE_MAGIC[4] = {'F', 'B', 'G', 'S'};
+
+/**
+ * @brief Writes header, board and player to a file.
+ * @param path File to write.
+ * @param board Board to save.
+ * @param player Player to save.
+ * @return True if the file was written completely.
+ */
+bool SaveGame::save(const std::string &path, const Board &board, const Player &player)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+
+    BinaryIO::writeArray(out, SAVE_MAGIC, sizeof(SAVE_MAGIC));
+    BinaryIO::write(out, VERSION);
+    BinaryIO::write(out, static_cast<std::uint8_t>(Utility::isNight() ? 1 : 0));
+    board.save(out);
+    player.save(out);
+    out.flush();
+    return static_cast<bool>(out);
+}
+
+/**
+ * @brief Reads header, board and player from a file.
+ * @param path File to read.
+ * @param board Receives the board.
+ * @param player Receives the player.
+ * @return True on success.
+ */
+bool SaveGame::load(const std::string &path, std::unique_ptr<Board> &board,
+                    std::unique_ptr<Player> &player)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+
+    char magic[sizeof(SAVE_MAGIC)];
+    std::uint32_t version = 0;
+    std::uint8_t night = 0;
+    if (!BinaryIO::readArray(in, magic, sizeof(magic)) || !BinaryIO::read(in, version)
+        || !BinaryIO::read(in, night)) return false;
+    if (!std::equal(magic, magic + sizeof(magic), SAVE_MAGIC) || version != VERSION) return false;
+
+    const bool wasNight = Utility::isNight();
+    Utility::setNight(night != 0);
+
+    std::unique_ptr<Board> loadedBoard = Board::load(in);
+    std::unique_ptr<Player> loadedPlayer = loadedBoard ? Player::load(in) : nullptr;
+    if (!loadedPlayer || loadedPlayer->getX() < 0 || loadedPlayer->getY() < 0
+        || loadedPlayer->getX() >= loadedBoard->getWidth()
+        || loadedPlayer->getY() >= loadedBoard->getHeight()) {
+        Utility::setNight(wasNight);
+        return false;
+    }
+
+    board = std::move(loadedBoard);
+    player = std::move(loadedPlayer);
+    return true;
+}
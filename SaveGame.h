@@ -0,0 +1,70 @@
+/**
+ * @file SaveGame.h
+ * @brief Declares the SaveGame class, which writes and reads complete game saves.
+ *
+ * A save file holds, in order:
+ *  - A header: magic "FBGS", uint32 format version, uint8 day/night flag
+ *  - The Board (see Board::save)
+ *  - The Player (see Player::save)
+ *
+ * Everything is streamed directly to and from the file in binary form.
+ */
+
+#ifndef SAVEGAME_H
+#define SAVEGAME_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class Board;
+class Player;
+
+/**
+ * @class SaveGame
+ * @brief Static helpers to persist and restore a Board, Player and day/night state.
+ *
+ * Design:
+ *  - All functions are static.
+ *  - No instances are allowed (constructor is deleted).
+ *  - Failures are reported through return values; nothing is thrown.
+ */
+class SaveGame {
+public:
+
+    /// Current save format version; bumped whenever the layout changes.
+    static constexpr std::uint32_t VERSION = 1;
+
+    /**
+     * @brief Writes a complete save file.
+     *
+     * @param path File to create or overwrite.
+     * @param board Board to save.
+     * @param player Player to save.
+     * @return true if everything was written successfully.
+     */
+    static bool save(const std::string &path, const Board &board, const Player &player);
+
+    /**
+     * @brief Reads a complete save file.
+     *
+     * PSEUDOCODE:
+     * 1. Check magic and version.
+     * 2. Restore the day/night flag (enemies and Orcs depend on it).
+     * 3. Load the Board, then the Player.
+     * 4. Reject the file if the player stands outside the board.
+     *
+     * @param path File to read.
+     * @param board Receives the loaded board on success.
+     * @param player Receives the loaded player on success.
+     * @return true on success; on failure board and player are left unchanged.
+     */
+    static bool load(const std::string &path, std::unique_ptr<Board> &board,
+                     std::unique_ptr<Player> &player);
+
+private:
+    /// Private constructor to prevent instantiation
+    SaveGame() = delete;
+};
+
+#endif // SAVEGAME_H
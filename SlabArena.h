@@ -0,0 +1,263 @@
+/**
+ * @file SlabArena.h
+ * @brief Declares SlabArena, slab-based in-place storage for objects addressed by id.
+ *
+ * A SlabArena constructs its objects directly in large, fixed-size slabs
+ * of raw storage instead of giving each object its own heap block:
+ *
+ *  - Creating an object costs one heap allocation per SLAB_SIZE objects
+ *    (none at all while the current slab has room or a freed slot exists).
+ *  - Objects never move: growing the arena adds a slab, so ids and pointers
+ *    stay valid until the object is erased.
+ *  - Tearing the arena down runs the destructors (skipped entirely for
+ *    trivially destructible types) and then releases whole slabs, so a
+ *    Board's occupants are freed in a handful of large deallocations.
+ *
+ * The arena is also a slot map: every slot carries a generation that is
+ * bumped whenever its object is destroyed, and a SlotHandle (slot index +
+ * generation, 32 bits) resolves in O(1) to the object only while that
+ * object is alive. Holders of a handle can therefore detect a stale
+ * reference instead of dangling.
+ *
+ * The arena is a template over the stored type, so any Board-scoped object
+ * population can plug into it; OccupantPool uses it for enemies.
+ */
+
+#ifndef SLABARENA_H
+#define SLABARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Occupancy.h"
+
+/**
+ * @class SlotHandle
+ * @brief 32-bit generational reference to an object in a SlabArena.
+ *
+ * Layout:
+ *  bits 31..22 – generation of the slot when the handle was issued
+ *  bits 21..0  – slot index
+ *
+ * A default-constructed handle is null: its index is INDEX_MASK, which no
+ * arena hands out, so it never resolves. Generations wrap after 1024 reuses
+ * of one slot.
+ */
+class SlotHandle {
+public:
+    static constexpr int INDEX_BITS = 22;                                     ///< Width of the index field.
+    static constexpr std::uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;       ///< Selects the index; also the null index.
+    static constexpr std::uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1; ///< Range of a generation.
+
+    /// Constructs a null handle.
+    SlotHandle() = default;
+
+    /**
+     * @brief Constructs a handle to a slot.
+     * @param index Slot index. @pre index < INDEX_MASK
+     * @param generation Slot generation (only the low bits are kept).
+     */
+    SlotHandle(std::uint32_t index, std::uint32_t generation)
+        : bits_(((generation & GENERATION_MASK) << INDEX_BITS) | index) {}
+
+    /// @return The slot index.
+    std::uint32_t index() const { return bits_ & INDEX_MASK; }
+
+    /// @return The slot generation.
+    std::uint32_t generation() const { return bits_ >> INDEX_BITS; }
+
+    /// @return true for the null handle.
+    bool isNull() const { return index() == INDEX_MASK; }
+
+    /// @return The packed 32-bit value (e.g. for hashing or storage).
+    std::uint32_t bits() const { return bits_; }
+
+    bool operator==(SlotHandle o) const { return bits_ == o.bits_; }
+    bool operator!=(SlotHandle o) const { return bits_ != o.bits_; }
+
+private:
+    std::uint32_t bits_ = INDEX_MASK; ///< Generation above, index below.
+};
+
+static_assert(sizeof(SlotHandle) == 4, "a handle must stay 32 bits");
+
+/**
+ * @class SlabArena
+ * @brief Id-addressed object storage carved out of fixed-size slabs.
+ *
+ * @tparam T Stored type.
+ * @tparam SLAB_SIZE Objects per slab; a multiple of 64 (one live-bitmap word).
+ *
+ * PSEUDOCODE:
+ *  emplace(args):  id = free_.pop() or size_++ (adding a slab when full)
+ *                  construct T(args) in slot id; mark id live; return id
+ *  erase(id):      destroy slot id; mark id dead; ++generation[id]; free_.push(id)
+ *  clear():        destroy every live slot; drop all slabs; ++epoch (new slabs' first generation)
+ *  find(handle):   live and generation matches → object, else nullptr
+ *
+ * Slot id lives in slab id / SLAB_SIZE at offset id % SLAB_SIZE.
+ */
+template <typename T, size_t SLAB_SIZE = 256>
+class SlabArena {
+    static_assert(SLAB_SIZE % 64 == 0, "slab size must be a whole number of bitmap words");
+
+public:
+    SlabArena() = default;
+    ~SlabArena() { destroyLive(); }
+
+    SlabArena(const SlabArena &) = delete;
+    SlabArena &operator=(const SlabArena &) = delete;
+
+    /// Takes over other's slabs; other is left empty.
+    SlabArena(SlabArena &&other) noexcept
+        : slabs_(std::move(other.slabs_)), live_(std::move(other.live_)),
+          free_(std::move(other.free_)), size_(std::exchange(other.size_, 0)), epoch_(other.epoch_) {}
+
+    /// Destroys this arena's objects, then takes over other's slabs.
+    SlabArena &operator=(SlabArena &&other) noexcept {
+        if (this != &other) {
+            clear();
+            slabs_ = std::move(other.slabs_);
+            live_ = std::move(other.live_);
+            free_ = std::move(other.free_);
+            size_ = std::exchange(other.size_, 0);
+            epoch_ = std::max(epoch_, other.epoch_); // new slabs must not match handles from either arena
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Constructs a T in place.
+     * @param args Constructor arguments.
+     * @return Id of the new object.
+     */
+    template <typename... Args>
+    std::uint32_t emplace(Args &&...args) {
+        std::uint32_t id;
+        if (!free_.empty()) {
+            id = free_.back();
+            free_.pop_back();
+        } else {
+            if (size_ == slabs_.size() * SLAB_SIZE) {
+                slabs_.push_back(std::unique_ptr<Slab>(new Slab)); // objects uninitialised on purpose
+                std::fill_n(slabs_.back()->generations, SLAB_SIZE, epoch_);
+                live_.resize(live_.size() + SLAB_SIZE / 64, 0);
+            }
+            id = static_cast<std::uint32_t>(size_++);
+        }
+        ::new (static_cast<void *>(slot(id))) T(std::forward<Args>(args)...);
+        live_[id / 64] |= std::uint64_t{1} << (id % 64);
+        return id;
+    }
+
+    /// @return The object with the given id. @pre id is live.
+    T &operator[](std::uint32_t id) { return *std::launder(slot(id)); }
+
+    /// @copydoc operator[](std::uint32_t)
+    const T &operator[](std::uint32_t id) const { return *std::launder(slot(id)); }
+
+    /**
+     * @brief Returns a generational handle to an object.
+     * @param id Id of the object. @pre id is live.
+     * @return The handle, or a null handle if id does not fit in SlotHandle::INDEX_BITS.
+     */
+    SlotHandle handle(std::uint32_t id) const {
+        if (id >= SlotHandle::INDEX_MASK) return {};
+        return {id, generation(id)};
+    }
+
+    /**
+     * @brief Resolves a handle in O(1).
+     * @param h Handle from handle().
+     * @return The object, or nullptr if h is null or its object has been erased.
+     */
+    T *find(SlotHandle h) {
+        return const_cast<T *>(std::as_const(*this).find(h));
+    }
+
+    /// @copydoc find(SlotHandle)
+    const T *find(SlotHandle h) const {
+        const std::uint32_t id = h.index();
+        if (id >= size_ || !(live_[id / 64] >> (id % 64) & 1)) return nullptr;
+        if (generation(id) != h.generation()) return nullptr;
+        return &(*this)[id];
+    }
+
+    /**
+     * @brief Destroys an object and recycles its slot.
+     *
+     * Handles to the object go stale: the slot's generation moves on.
+     *
+     * @param id Id of the object. @pre id is live.
+     */
+    void erase(std::uint32_t id) {
+        (*this)[id].~T();
+        live_[id / 64] &= ~(std::uint64_t{1} << (id % 64));
+        generation(id) = static_cast<std::uint16_t>((generation(id) + 1) & SlotHandle::GENERATION_MASK);
+        free_.push_back(id);
+    }
+
+    /**
+     * @brief Destroys every object and releases all slabs.
+     *
+     * Destructors run in slot order, visiting only live slots via the
+     * bitmap; for trivially destructible T nothing is visited at all.
+     * Slabs allocated afterwards start past every generation used so far,
+     * so handles issued before the clear do not resolve to the new objects.
+     */
+    void clear() {
+        destroyLive();
+        std::uint16_t newest = epoch_;
+        for (std::uint32_t id = 0; id < size_; ++id) newest = std::max(newest, generation(id));
+        epoch_ = static_cast<std::uint16_t>((newest + 1) & SlotHandle::GENERATION_MASK);
+        slabs_.clear();
+        live_.clear();
+        free_.clear();
+        size_ = 0;
+    }
+
+    /// @return Number of live objects.
+    size_t size() const { return size_ - free_.size(); }
+
+    /// @return Number of slabs currently allocated.
+    size_t slabCount() const { return slabs_.size(); }
+
+private:
+    /// Raw, suitably aligned storage for SLAB_SIZE objects, plus their slot generations.
+    struct Slab {
+        alignas(T) unsigned char bytes[sizeof(T) * SLAB_SIZE];
+        std::uint16_t generations[SLAB_SIZE]; ///< Bumped each time the slot's object is destroyed.
+    };
+
+    /// Runs the destructor of every live object (nothing for trivially destructible T).
+    void destroyLive() {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (size_t w = 0; w < live_.size(); ++w) {
+                for (std::uint64_t bits = live_[w]; bits; bits &= bits - 1) {
+                    (*this)[static_cast<std::uint32_t>(w * 64 + Bits::countTrailingZeros(bits))].~T();
+                }
+            }
+        }
+    }
+
+    /// @return Generation of slot id. @pre id < size_
+    std::uint16_t &generation(std::uint32_t id) const { return slabs_[id / SLAB_SIZE]->generations[id % SLAB_SIZE]; }
+
+    /// @return Address of slot id (whether or not it is live).
+    T *slot(std::uint32_t id) const {
+        return reinterpret_cast<T *>(slabs_[id / SLAB_SIZE]->bytes) + id % SLAB_SIZE;
+    }
+
+    std::vector<std::unique_ptr<Slab>> slabs_; ///< Slab storage, in id order.
+    std::vector<std::uint64_t> live_;          ///< One bit per slot: constructed or not.
+    std::vector<std::uint32_t> free_;          ///< Erased slots, reused first.
+    size_t size_ = 0;                          ///< Slots handed out so far (live or freed).
+    std::uint16_t epoch_ = 0;                  ///< Starting generation of new slabs; advanced by clear().
+};
+
+#endif // SLABARENA_H
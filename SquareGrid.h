@@ -0,0 +1,144 @@
+/**
+ * @file SquareGrid.h
+ * @brief Declares SquareGrid, the dense square storage of a Board, and its layout policies.
+ *
+ * A SquareGrid stores every BoardSquare of a dense board in one contiguous
+ * array. Where square (x, y) lives in that array is decided by a layout
+ * policy chosen at compile time:
+ *
+ *  - RowMajorLayout: index = y * width + x. Horizontal neighbours are adjacent,
+ *    but a vertical step jumps a whole row.
+ *  - MortonLayout: the board is cut into 64x64 tiles stored one after the
+ *    other, and the squares of a tile are stored in Z-order (Morton order),
+ *    so squares that are close in both directions are close in memory.
+ *
+ * Both policies keep every 64x64 generation chunk's squares addressable by
+ * (x, y); only the address arithmetic differs.
+ */
+
+#ifndef SQUAREGRID_H
+#define SQUAREGRID_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BoardSquare.h"
+
+/**
+ * @struct RowMajorLayout
+ * @brief Classic row-major indexing.
+ */
+struct RowMajorLayout {
+    size_t width = 0; ///< Columns of the board.
+
+    RowMajorLayout() = default;
+
+    /// @param w Board width. @param h Board height (unused).
+    RowMajorLayout(int w, int /*h*/) : width(static_cast<size_t>(w)) {}
+
+    /// @return Number of squares to allocate for a w x h board.
+    static size_t storageSize(int w, int h) {
+        return static_cast<size_t>(w) * static_cast<size_t>(h);
+    }
+
+    /// @return Array index of square (x, y).
+    size_t index(int x, int y) const {
+        return static_cast<size_t>(y) * width + static_cast<size_t>(x);
+    }
+};
+
+/**
+ * @namespace Morton
+ * @brief Bit interleaving used by MortonLayout.
+ */
+namespace Morton {
+
+/// @return v's low 6 bits spread to the even bit positions 0, 2, ..., 10.
+constexpr std::uint16_t spreadBits(std::uint32_t v) {
+    v = (v | (v << 4)) & 0x0F0Fu;
+    v = (v | (v << 2)) & 0x3333u;
+    v = (v | (v << 1)) & 0x5555u;
+    return static_cast<std::uint16_t>(v);
+}
+
+/// Builds the SPREAD lookup table at compile time.
+constexpr std::array<std::uint16_t, 64> makeSpreadTable() {
+    std::array<std::uint16_t, 64> table{};
+    for (std::uint32_t i = 0; i < 64; ++i) table[i] = spreadBits(i);
+    return table;
+}
+
+/// spreadBits() of every local tile coordinate; one load replaces the bit twiddling.
+inline constexpr std::array<std::uint16_t, 64> SPREAD = makeSpreadTable();
+
+} // namespace Morton
+
+/**
+ * @struct MortonLayout
+ * @brief Tiled Z-order indexing.
+ *
+ * index = (tileRow * tilesX + tileColumn) * TILE^2 + morton(x % TILE, y % TILE)
+ *
+ * morton() interleaves the bits of the local column (even bits) and row
+ * (odd bits). Edge tiles are allocated in full, so a board whose sides are
+ * not multiples of TILE stores a few padding squares.
+ */
+struct MortonLayout {
+    static constexpr int TILE = 64;       ///< Tile side; matches the Board's chunk size.
+    static constexpr int TILE_SHIFT = 6;  ///< log2(TILE).
+
+    size_t tilesX = 0; ///< Tiles per tile row.
+
+    MortonLayout() = default;
+
+    /// @param w Board width. @param h Board height (unused).
+    MortonLayout(int w, int /*h*/) : tilesX(static_cast<size_t>((w + TILE - 1) / TILE)) {}
+
+    /// @return Number of squares to allocate for a w x h board (whole tiles).
+    static size_t storageSize(int w, int h) {
+        return static_cast<size_t>((w + TILE - 1) / TILE) * static_cast<size_t>((h + TILE - 1) / TILE)
+               * TILE * TILE;
+    }
+
+    /// @return Array index of square (x, y).
+    size_t index(int x, int y) const {
+        const size_t tile = (static_cast<size_t>(y) >> TILE_SHIFT) * tilesX + (static_cast<size_t>(x) >> TILE_SHIFT);
+        const std::uint32_t local = Morton::SPREAD[static_cast<std::uint32_t>(x) & (TILE - 1)]
+                                    | (Morton::SPREAD[static_cast<std::uint32_t>(y) & (TILE - 1)] << 1);
+        return (tile << (2 * TILE_SHIFT)) + local;
+    }
+};
+
+/**
+ * @class SquareGrid
+ * @brief Dense, contiguous storage of BoardSquares addressed through a layout policy.
+ *
+ * @tparam Layout RowMajorLayout or MortonLayout (any type with the same interface).
+ */
+template <typename Layout>
+class SquareGrid {
+public:
+    /**
+     * @brief Allocates empty squares for a width x height board.
+     *
+     * Any previous contents are destroyed.
+     */
+    void resize(int width, int height) {
+        layout_ = Layout(width, height);
+        squares_.clear();
+        squares_.resize(Layout::storageSize(width, height));
+    }
+
+    /// @return The square at (x, y). @pre (x, y) is inside the board.
+    BoardSquare &at(int x, int y) { return squares_[layout_.index(x, y)]; }
+
+    /// @copydoc at(int, int)
+    const BoardSquare &at(int x, int y) const { return squares_[layout_.index(x, y)]; }
+
+private:
+    Layout layout_;                    ///< Address arithmetic for the current size.
+    std::vector<BoardSquare> squares_; ///< All squares, in layout order.
+};
+
+#endif // SQUAREGRID_H
@@ -1,75 +1,173 @@
-#include "Utility.h"
-#include <random>
-#include <chrono>
-
-/**
- * @file Utility.cpp
- * @brief Implements utility functions for random numbers, probability, and day/night management.
- *
- * Responsibilities:
- *  - Generate random integers and real numbers.
- *  - Evaluate probabilistic events.
- *  - Maintain and toggle a simple day/night flag.
- */
-
-/**
- * @brief Provides a reference to a static random number generator.
- * @return Reference to the Mersenne Twister RNG.
- */
-static std::mt19937 &rng() {
-    static std::mt19937 gen((unsigned)std::chrono::steady_clock::now().time_since_epoch().count());
-    return gen;
-}
-
-/**
- * @brief Generates a random integer between min and max (inclusive).
- *
- * @param min Minimum integer value.
- * @param max Maximum integer value.
- * @return Random integer in [min, max].
- */
-int Utility::randInt(int min, int max) {
-    std::uniform_int_distribution<int> dist(min, max);
-    return dist(rng());
-}
-
-/**
- * @brief Generates a random real number between min and max.
- *
- * @param min Minimum value.
- * @param max Maximum value.
- * @return Random double in [min, max).
- */
-double Utility::randReal(double min, double max) {
-    std::uniform_real_distribution<double> dist(min, max);
-    return dist(rng());
-}
-
-/**
- * @brief Returns true with a given probability.
- *
- * @param chance Probability in [0.0, 1.0].
- * @return true with probability `chance`, false otherwise.
- */
-bool Utility::probability(double chance) {
-    return randReal(0.0, 1.0) <= chance;
-}
-
-// simple internal day/night flag:
-static bool _isNight = false;
-
-/**
- * @brief Toggles the day/night state.
- */
-void Utility::toggleDayNight() {
-    _isNight = !_isNight;
-}
-
-/**
- * @brief Returns true if it is currently night, false if day.
- *
- * @return Current day/night state.
- */
-bool Utility::isNight() {
-    return _isNight;
-}
+#include "Utility.h"
+#include <random>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+/**
+ * @file Utility.cpp
+ * @brief Implements utility functions for random numbers, probability, and day/night management.
+ *
+ * Responsibilities:
+ *  - Generate random integers and real numbers.
+ *  - Derive reproducible per-chunk random streams from a world seed.
+ *  - Evaluate probabilistic events.
+ *  - Maintain and toggle a simple day/night flag.
+ */
+
+/**
+ * @brief Provides a reference to a static random number generator.
+ * @return Reference to the Mersenne Twister RNG.
+ */
+static std::mt19937 &rng() {
+    static std::mt19937 gen((unsigned)std::chrono::steady_clock::now().time_since_epoch().count());
+    return gen;
+}
+
+/**
+ * @brief Generates a random integer between min and max (inclusive).
+ *
+ * @param min Minimum integer value.
+ * @param max Maximum integer value.
+ * @return Random integer in [min, max].
+ */
+int Utility::randInt(int min, int max) {
+    std::uniform_int_distribution<int> dist(min, max);
+    return dist(rng());
+}
+
+/**
+ * @brief Generates a random integer between min and max (inclusive) from a given engine.
+ *
+ * @param gen Random engine to draw from.
+ * @param min Minimum integer value.
+ * @param max Maximum integer value.
+ * @return Random integer in [min, max].
+ */
+int Utility::randInt(std::mt19937 &gen, int min, int max) {
+    std::uniform_int_distribution<int> dist(min, max);
+    return dist(gen);
+}
+
+/**
+ * @brief Fills a buffer with random integers in [min, max] from a given engine.
+ *
+ * Lemire's multiply-shift mapping: the high half of word * range is uniform
+ * once words whose low half falls below (2^32 - range) % range are redrawn.
+ *
+ * @param gen Random engine to draw from.
+ * @param min Minimum value.
+ * @param max Maximum value.
+ * @param out Receives n values.
+ * @param n Number of values.
+ */
+void Utility::randIntBatch(std::mt19937 &gen, int min, int max, std::uint8_t *out, size_t n) {
+    const std::uint32_t range = static_cast<std::uint32_t>(max - min + 1);
+    const std::uint32_t threshold = (0u - range) % range;
+    for (size_t i = 0; i < n; ++i) {
+        std::uint64_t m = static_cast<std::uint64_t>(static_cast<std::uint32_t>(gen())) * range;
+        while (static_cast<std::uint32_t>(m) < threshold) {
+            m = static_cast<std::uint64_t>(static_cast<std::uint32_t>(gen())) * range;
+        }
+        out[i] = static_cast<std::uint8_t>(min + static_cast<int>(m >> 32));
+    }
+}
+
+/**
+ * @brief Returns a fresh 64-bit seed drawn from the global generator.
+ * @return Random seed.
+ */
+std::uint64_t Utility::randomSeed() {
+    return (static_cast<std::uint64_t>(rng()()) << 32) | rng()();
+}
+
+/**
+ * @brief SplitMix64 finalizer; scrambles all input bits into all output bits.
+ * @param z Value to mix.
+ * @return Mixed value.
+ */
+static std::uint64_t mix64(std::uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Derives an independent stream seed from a world seed and two coordinates.
+ *
+ * @param seed World seed.
+ * @param a First coordinate.
+ * @param b Second coordinate.
+ * @return 32-bit seed that depends only on (seed, a, b).
+ */
+std::uint32_t Utility::deriveSeed(std::uint64_t seed, std::uint64_t a, std::uint64_t b) {
+    std::uint64_t h = mix64(seed + 0x9E3779B97F4A7C15ULL);
+    h = mix64(h ^ (a + 0x9E3779B97F4A7C15ULL));
+    h = mix64(h ^ (b + 0x9E3779B97F4A7C15ULL));
+    return static_cast<std::uint32_t>(h ^ (h >> 32));
+}
+
+/**
+ * @brief Generates a random real number between min and max.
+ *
+ * @param min Minimum value.
+ * @param max Maximum value.
+ * @return Random double in [min, max).
+ */
+double Utility::randReal(double min, double max) {
+    std::uniform_real_distribution<double> dist(min, max);
+    return dist(rng());
+}
+
+/**
+ * @brief Returns true with a given probability.
+ *
+ * @param chance Probability in [0.0, 1.0].
+ * @return true with probability `chance`, false otherwise.
+ */
+bool Utility::probability(double chance) {
+    return randReal(0.0, 1.0) <= chance;
+}
+
+// simple internal day/night flag:
+static bool _isNight = false;
+
+/**
+ * @brief Toggles the day/night state.
+ */
+void Utility::toggleDayNight() {
+    _isNight = !_isNight;
+}
+
+/**
+ * @brief Sets the day/night state.
+ * @param night True for night, false for day.
+ */
+void Utility::setNight(bool night) {
+    _isNight = night;
+}
+
+/**
+ * @brief Returns true if it is currently night, false if day.
+ *
+ * @return Current day/night state.
+ */
+bool Utility::isNight() {
+    return _isNight;
+}
+
+/**
+ * @brief Returns the interned copy of a string.
+ *
+ * Texts live in a node-based set, so an entry never moves once inserted.
+ *
+ * @param text Text to intern.
+ * @return View of the interned copy.
+ */
+std::string_view Utility::intern(std::string_view text) {
+    static std::mutex mutex;
+    static std::unordered_set<std::string> table;
+    std::lock_guard<std::mutex> lock(mutex);
+    return *table.emplace(text).first;
+}
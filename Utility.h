@@ -1,70 +1,141 @@
-#ifndef UTILITY_H
-#define UTILITY_H
-
-/**
- * @file Utility.h
- * @brief Provides static utility functions for RNG, probability, and day/night toggling.
- *
- * The Utility class offers general-purpose static methods used across modules,
- * including random number generation, probability checks, and day/night state management.
- * This class is non-instantiable.
- */
-
-/**
-  * @class Utility
-  * @brief A static utility class for common operations.
-  *
-  * Responsibilities:
-  *  - Generate random integers and real numbers.
-  *  - Evaluate probability-based events.
-  *  - Toggle and query day/night state.
-  *
-  * Design:
-  *  - All functions are static.
-  *  - No instances are allowed (constructor is deleted).
-  */
-class Utility {
-public:
-
-    /**
-     * @brief Generates a random integer between min and max (inclusive).
-     * @param min Minimum value.
-     * @param max Maximum value.
-     * @return Random integer in [min, max].
-     */
-    static int randInt(int min, int max);
-
-    /**
-     * @brief Generates a random real number between min and max.
-     * @param min Minimum value.
-     * @param max Maximum value.
-     * @return Random double in [min, max].
-     */
-    static double randReal(double min, double max);
-
-    /**
-     * @brief Evaluates a probability check.
-     * @param chance Probability of returning true (0.0 = 0%, 1.0 = 100%).
-     * @return True with probability `chance`, false otherwise.
-     */
-    static bool probability(double chance);
-
-    /**
-     * @brief Toggles the internal day/night state.
-     *
-     * Flips the internal flag; if it was day, becomes night, and vice versa.
-     */
-    static void toggleDayNight();
-
-    /**
-     * @brief Checks if it is currently night.
-     * @return True if night, false if day.
-     */
-    static bool isNight();
-
-private:
-    /// Private constructor to prevent instantiation
-    Utility() = delete;
-};
-
-#endif // UTILITY_H
+#ifndef UTILITY_H
+#define UTILITY_H
+
+#include <cstdint>
+#include <random>
+#include <string_view>
+
+/**
+ * @file Utility.h
+ * @brief Provides static utility functions for RNG, probability, and day/night toggling.
+ *
+ * The Utility class offers general-purpose static methods used across modules,
+ * including random number generation, probability checks, and day/night state management.
+ * This class is non-instantiable.
+ */
+
+/**
+  * @class Utility
+  * @brief A static utility class for common operations.
+  *
+  * Responsibilities:
+  *  - Generate random integers and real numbers.
+  *  - Derive independent, reproducible random streams from a world seed.
+  *  - Evaluate probability-based events.
+  *  - Toggle and query day/night state.
+  *
+  * Design:
+  *  - All functions are static.
+  *  - No instances are allowed (constructor is deleted).
+  */
+class Utility {
+public:
+
+    /**
+     * @brief Generates a random integer between min and max (inclusive).
+     * @param min Minimum value.
+     * @param max Maximum value.
+     * @return Random integer in [min, max].
+     */
+    static int randInt(int min, int max);
+
+    /**
+     * @brief Generates a random integer between min and max (inclusive) from a given engine.
+     *
+     * Used by seeded world generation, where each chunk draws from its own stream
+     * instead of the shared global generator.
+     *
+     * @param gen Random engine to draw from.
+     * @param min Minimum value.
+     * @param max Maximum value.
+     * @return Random integer in [min, max].
+     */
+    static int randInt(std::mt19937 &gen, int min, int max);
+
+    /**
+     * @brief Fills a buffer with random integers between min and max (inclusive).
+     *
+     * Uniform like randInt(gen, min, max), but each engine word is mapped to
+     * the range with one multiply and shift (rejecting the rare biased words)
+     * instead of building a distribution per value, so a batch is one tight
+     * loop. The values differ from those n randInt() calls would produce.
+     *
+     * @param gen Random engine to draw from.
+     * @param min Minimum value. @pre 0 <= min <= max <= 255
+     * @param max Maximum value.
+     * @param out Receives n values.
+     * @param n Number of values.
+     */
+    static void randIntBatch(std::mt19937 &gen, int min, int max, std::uint8_t *out, size_t n);
+
+    /**
+     * @brief Returns a fresh, non-deterministic 64-bit seed from the global generator.
+     * @return Seed suitable for a new world.
+     */
+    static std::uint64_t randomSeed();
+
+    /**
+     * @brief Derives the seed of an independent random stream from a world seed.
+     *
+     * The result depends only on its arguments, so the same (seed, a, b) always
+     * yields the same stream regardless of the order in which streams are created.
+     *
+     * @param seed World seed.
+     * @param a First stream coordinate (e.g. chunk x).
+     * @param b Second stream coordinate (e.g. chunk y).
+     * @return 32-bit seed for a std::mt19937.
+     */
+    static std::uint32_t deriveSeed(std::uint64_t seed, std::uint64_t a, std::uint64_t b);
+
+    /**
+     * @brief Generates a random real number between min and max.
+     * @param min Minimum value.
+     * @param max Maximum value.
+     * @return Random double in [min, max].
+     */
+    static double randReal(double min, double max);
+
+    /**
+     * @brief Evaluates a probability check.
+     * @param chance Probability of returning true (0.0 = 0%, 1.0 = 100%).
+     * @return True with probability `chance`, false otherwise.
+     */
+    static bool probability(double chance);
+
+    /**
+     * @brief Toggles the internal day/night state.
+     *
+     * Flips the internal flag; if it was day, becomes night, and vice versa.
+     */
+    static void toggleDayNight();
+
+    /**
+     * @brief Sets the day/night state directly (used when loading a saved game).
+     * @param night True for night, false for day.
+     */
+    static void setNight(bool night);
+
+    /**
+     * @brief Checks if it is currently night.
+     * @return True if night, false if day.
+     */
+    static bool isNight();
+
+    /**
+     * @brief Returns the interned copy of a string.
+     *
+     * The first call for a given text copies it into a global table; every
+     * call returns a view of that single copy, which stays valid (and at the
+     * same address) until program exit. Safe to call from several threads.
+     *
+     * @param text Text to intern.
+     * @return Stable view of the interned text.
+     */
+    static std::string_view intern(std::string_view text);
+
+private:
+    /// Private constructor to prevent instantiation
+    Utility() = delete;
+};
+
+#endif // UTILITY_H
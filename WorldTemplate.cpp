@@ -0,0 +1,196 @@
+#include "WorldTemplate.h"
+#include "Board.h"
+#include "BinaryIO.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file WorldTemplate.cpp
+ * @brief Implements writing world template files and mapping them read-only.
+ *
+ * The file is laid out so that it can be used in place: every section starts
+ * at a multiple of its alignment, and the records and occupancy blocks are
+ * trivially copyable, so the mapping is accessed directly through typed pointers
+ * without any parsing or per-square allocation.
+ */
+
+namespace {
+
+/// Fixed-size header at the start of every template file.
+struct TemplateHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::int32_t width;
+    std::int32_t height;
+    std::int32_t chunksX;
+    std::int32_t chunksY;
+    std::uint8_t reserved[8];
+};
+
+static_assert(sizeof(TemplateHeader) == 32, "template header must stay 32 bytes");
+static_assert(sizeof(SquareRecord) == 4, "template records must stay 4 bytes");
+
+constexpr char TEMPLATE_MAGIC[4] = {'F', 'B', 'G', 'T'};
+
+/// @return value rounded up to a multiple of alignment.
+size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+/// @return Byte offset of the occupancy section for a width x height world.
+size_t occupancyOffset(size_t width, size_t height) {
+    return alignUp(sizeof(TemplateHeader) + width * height * sizeof(SquareRecord), alignof(OccupancyBlock));
+}
+
+} // namespace
+
+/**
+ * @brief Writes the header, every square record and every chunk's bitmaps.
+ * @param path Output file.
+ * @param board Board to export.
+ * @return true on success.
+ */
+bool WorldTemplate::write(const std::string &path, const Board &board)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+
+    const int width = board.getWidth();
+    const int height = board.getHeight();
+    const int chunksX = (width + Board::CHUNK_SIZE - 1) / Board::CHUNK_SIZE;
+    const int chunksY = (height + Board::CHUNK_SIZE - 1) / Board::CHUNK_SIZE;
+
+    TemplateHeader header{};
+    std::memcpy(header.magic, TEMPLATE_MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.width = width;
+    header.height = height;
+    header.chunksX = chunksX;
+    header.chunksY = chunksY;
+    BinaryIO::write(out, header);
+
+    const size_t recordsEnd = sizeof(TemplateHeader)
+                              + static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(SquareRecord);
+    const size_t blocksAt = occupancyOffset(static_cast<size_t>(width), static_cast<size_t>(height));
+    const std::vector<char> padding(blocksAt - recordsEnd, 0);
+    out.seekp(static_cast<std::streamoff>(recordsEnd));
+    BinaryIO::writeArray(out, padding.data(), padding.size());
+
+    // One band of CHUNK_SIZE rows at a time: copy each chunk of the band out of
+    // the board (never keeping a generated chunk), then write the band's rows
+    // and bitmaps to their places in the file
+    constexpr size_t CHUNK_SQUARES = static_cast<size_t>(Board::CHUNK_SIZE) * Board::CHUNK_SIZE;
+    std::vector<SquareRecord> chunk(CHUNK_SQUARES);
+    std::vector<SquareRecord> band(static_cast<size_t>(Board::CHUNK_SIZE) * static_cast<size_t>(width));
+    std::vector<OccupancyBlock> blocks(static_cast<size_t>(chunksX));
+    for (int cy = 0; cy < chunksY; ++cy) {
+        const int rows = std::min(Board::CHUNK_SIZE, height - cy * Board::CHUNK_SIZE);
+        for (int cx = 0; cx < chunksX; ++cx) {
+            board.copyChunk(cx, cy, chunk.data(), blocks[static_cast<size_t>(cx)]);
+            const int columns = std::min(Board::CHUNK_SIZE, width - cx * Board::CHUNK_SIZE);
+            for (int ly = 0; ly < rows; ++ly) {
+                std::copy_n(chunk.begin() + ly * Board::CHUNK_SIZE, columns,
+                            band.begin() + static_cast<std::ptrdiff_t>(ly) * width + cx * Board::CHUNK_SIZE);
+            }
+        }
+        const size_t bandAt = sizeof(TemplateHeader)
+                              + static_cast<size_t>(cy) * Board::CHUNK_SIZE * static_cast<size_t>(width) * sizeof(SquareRecord);
+        out.seekp(static_cast<std::streamoff>(bandAt));
+        BinaryIO::writeArray(out, band.data(), static_cast<size_t>(rows) * static_cast<size_t>(width));
+        out.seekp(static_cast<std::streamoff>(blocksAt + static_cast<size_t>(cy) * blocks.size() * sizeof(OccupancyBlock)));
+        BinaryIO::writeArray(out, blocks.data(), blocks.size());
+    }
+    return static_cast<bool>(out.flush());
+}
+
+/**
+ * @brief Maps a template file and validates its header and size.
+ * @param path Template file.
+ * @return The mapped template, or nullptr on failure.
+ */
+std::shared_ptr<const WorldTemplate> WorldTemplate::open(const std::string &path)
+{
+    std::shared_ptr<WorldTemplate> world(new WorldTemplate());
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return nullptr;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(TemplateHeader))) {
+        CloseHandle(file);
+        return nullptr;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) return nullptr;
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        return nullptr;
+    }
+    world->mappingHandle_ = mapping;
+    world->base_ = static_cast<const unsigned char *>(view);
+    world->size_ = static_cast<size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return nullptr;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(TemplateHeader))) {
+        ::close(fd);
+        return nullptr;
+    }
+    void *view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) return nullptr;
+    world->base_ = static_cast<const unsigned char *>(view);
+    world->size_ = static_cast<size_t>(info.st_size);
+#endif
+
+    TemplateHeader header;
+    std::memcpy(&header, world->base_, sizeof(header));
+    if (std::memcmp(header.magic, TEMPLATE_MAGIC, sizeof(header.magic)) != 0 || header.version != VERSION
+        || header.width <= 0 || header.height <= 0
+        || header.width > Constants::MAX_BOARD_SIDE || header.height > Constants::MAX_BOARD_SIDE) return nullptr;
+    if (header.chunksX != (header.width + Board::CHUNK_SIZE - 1) / Board::CHUNK_SIZE
+        || header.chunksY != (header.height + Board::CHUNK_SIZE - 1) / Board::CHUNK_SIZE) return nullptr;
+
+    const size_t width = static_cast<size_t>(header.width);
+    const size_t height = static_cast<size_t>(header.height);
+    const size_t blocksAt = occupancyOffset(width, height);
+    const size_t chunkCount = static_cast<size_t>(header.chunksX) * static_cast<size_t>(header.chunksY);
+    if (world->size_ != blocksAt + chunkCount * sizeof(OccupancyBlock)) return nullptr;
+
+    world->width_ = header.width;
+    world->height_ = header.height;
+    world->chunksX_ = header.chunksX;
+    world->records_ = reinterpret_cast<const SquareRecord *>(world->base_ + sizeof(TemplateHeader));
+    world->occupancy_ = reinterpret_cast<const OccupancyBlock *>(world->base_ + blocksAt);
+    return world;
+}
+
+/**
+ * @brief Unmaps the file.
+ */
+WorldTemplate::~WorldTemplate()
+{
+    if (!base_) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(base_);
+    CloseHandle(static_cast<HANDLE>(mappingHandle_));
+#else
+    munmap(const_cast<unsigned char *>(base_), size_);
+#endif
+}
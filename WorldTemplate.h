@@ -0,0 +1,104 @@
+/**
+ * @file WorldTemplate.h
+ * @brief Declares the WorldTemplate class, a pre-generated world mapped read-only from disk.
+ *
+ * A world template is a flat, pointer-free file holding every square of a
+ * generated Board as a SquareRecord plus the occupancy bitmaps of every chunk.
+ * It is written once and then memory-mapped read-only by any number of game
+ * sessions, which share the same physical pages through the OS page cache.
+ *
+ * Boards built from a template (BoardMode::TEMPLATE) read squares straight
+ * from the mapping and keep only a private copy-on-write overlay of the
+ * squares they change.
+ */
+
+#ifndef WORLDTEMPLATE_H
+#define WORLDTEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "BoardSquare.h"
+#include "Occupancy.h"
+
+class Board;
+
+/**
+ * @class WorldTemplate
+ * @brief Read-only, memory-mapped view of a generated world.
+ *
+ * File layout (host byte order):
+ *  - Header: magic "FBGT", uint32 version, int32 width, int32 height,
+ *            int32 chunksX, int32 chunksY, 8 reserved bytes (32 bytes total)
+ *  - width * height SquareRecords, row-major
+ *  - Padding to an 8-byte boundary
+ *  - chunksX * chunksY OccupancyBlocks, row-major by chunk
+ *
+ * Ownership:
+ *  Templates are shared between boards through std::shared_ptr; the mapping
+ *  is released when the last board using it is destroyed.
+ */
+class WorldTemplate {
+public:
+
+    /// Current template file format version.
+    static constexpr std::uint32_t VERSION = 1;
+
+    /**
+     * @brief Writes a board's complete contents as a template file.
+     *
+     * In CHUNKED mode chunks that have not been generated yet are generated
+     * one at a time into scratch storage and discarded once written, so the
+     * board does not grow while it is exported.
+     *
+     * @param path File to create or overwrite.
+     * @param board Board to export.
+     * @return true if the file was written completely.
+     */
+    static bool write(const std::string &path, const Board &board);
+
+    /**
+     * @brief Maps a template file read-only.
+     *
+     * @param path File written by write().
+     * @return The template, or nullptr if the file is missing, truncated or invalid.
+     */
+    static std::shared_ptr<const WorldTemplate> open(const std::string &path);
+
+    ~WorldTemplate();
+
+    WorldTemplate(const WorldTemplate &) = delete;
+    WorldTemplate &operator=(const WorldTemplate &) = delete;
+
+    /// @return Number of columns.
+    int getWidth() const { return width_; }
+
+    /// @return Number of rows.
+    int getHeight() const { return height_; }
+
+    /// @return The stored record of square (x, y). @pre (x, y) is in bounds.
+    const SquareRecord &record(int x, int y) const {
+        return records_[static_cast<size_t>(y) * static_cast<size_t>(width_) + static_cast<size_t>(x)];
+    }
+
+    /// @return The stored occupancy bitmaps of chunk (cx, cy). @pre the chunk exists.
+    const OccupancyBlock &occupancy(int cx, int cy) const {
+        return occupancy_[static_cast<size_t>(cy) * static_cast<size_t>(chunksX_) + static_cast<size_t>(cx)];
+    }
+
+private:
+    /// Use open(); a template only exists as a successful mapping.
+    WorldTemplate() = default;
+
+    const unsigned char *base_ = nullptr;       ///< Start of the mapping.
+    size_t size_ = 0;                           ///< Length of the mapping in bytes.
+    void *mappingHandle_ = nullptr;             ///< OS handle kept for unmapping (Windows only).
+    int width_ = 0;                             ///< Columns.
+    int height_ = 0;                            ///< Rows.
+    int chunksX_ = 0;                           ///< Chunk columns.
+    const SquareRecord *records_ = nullptr;     ///< Points into the mapping.
+    const OccupancyBlock *occupancy_ = nullptr; ///< Points into the mapping.
+};
+
+#endif // WORLDTEMPLATE_H
@@ -0,0 +1,69 @@
+#include "Benchmarks.h"
+#include "Board.h"
+#include "Enemy.h"
+#include "SlabArena.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/**
+ * @file ArenaBench.cpp
+ * @brief Times enemy storage: SlabArena against one heap allocation per enemy,
+ *        and whole-board create/destroy cycles.
+ *
+ * The first table builds and destroys the same enemies either one
+ * std::make_unique at a time (how board enemies used to be stored) or in a
+ * SlabArena<Enemy> (how OccupantPool stores them). The second creates,
+ * populates and destroys DENSE boards.
+ */
+
+void Benchmarks::arena()
+{
+    constexpr int ENEMIES = 1 << 20;
+    constexpr int ROUNDS = 5;
+
+    std::cout << ENEMIES << " enemies, best of " << ROUNDS << " rounds, ns per enemy\n"
+              << "storage        create  destroy\n";
+    double heapCreate = 1e9, heapDestroy = 1e9, arenaCreate = 1e9, arenaDestroy = 1e9;
+    for (int round = 0; round < ROUNDS; ++round) {
+        std::vector<std::unique_ptr<Enemy>> heap;
+        heap.reserve(ENEMIES);
+        auto start = Clock::now();
+        for (int i = 0; i < ENEMIES; ++i) heap.push_back(std::make_unique<Enemy>(i % Constants::RACE_COUNT));
+        heapCreate = std::min(heapCreate, secondsSince(start));
+        start = Clock::now();
+        heap.clear();
+        heapDestroy = std::min(heapDestroy, secondsSince(start));
+
+        SlabArena<Enemy> slabs;
+        start = Clock::now();
+        for (int i = 0; i < ENEMIES; ++i) slabs.emplace(i % Constants::RACE_COUNT);
+        arenaCreate = std::min(arenaCreate, secondsSince(start));
+        start = Clock::now();
+        slabs.clear();
+        arenaDestroy = std::min(arenaDestroy, secondsSince(start));
+    }
+    std::cout << std::fixed << std::setprecision(1)
+              << "make_unique  " << std::setw(8) << heapCreate * 1e9 / ENEMIES << std::setw(9) << heapDestroy * 1e9 / ENEMIES << "\n"
+              << "SlabArena    " << std::setw(8) << arenaCreate * 1e9 / ENEMIES << std::setw(9) << arenaDestroy * 1e9 / ENEMIES << "\n\n";
+
+    std::cout << "DENSE board create/populate/destroy cycles, seconds per cycle\n"
+              << "     size  cycles  initialize  destroy\n";
+    for (const int size : {2048, 4096}) {
+        const int cycles = size == 2048 ? 5 : 2;
+        double init = 0.0, destroy = 0.0;
+        for (int c = 0; c < cycles; ++c) {
+            auto board = std::make_unique<Board>(size, size, BoardMode::DENSE, 7);
+            auto start = Clock::now();
+            board->initialize(1);
+            init += secondsSince(start);
+            start = Clock::now();
+            board.reset();
+            destroy += secondsSince(start);
+        }
+        std::cout << std::setw(4) << size << "x" << std::left << std::setw(4) << size << std::right << std::setw(8)
+                  << cycles << std::setprecision(3) << std::setw(12) << init / cycles << std::setw(9) << destroy / cycles
+                  << std::setprecision(1) << "\n";
+    }
+}
@@ -0,0 +1,110 @@
+#include "Benchmarks.h"
+#include "Board.h"
+#include "Enemy.h"
+#include "ItemFactory.h"
+#include "OccupantPool.h"
+#include "Utility.h"
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/**
+ * @file BatchBench.cpp
+ * @brief Times batched world generation against one draw per square.
+ *
+ * Each pair of rows does the same work twice: once a value at a time
+ * (Utility::randInt, ItemFactory::randomItem, OccupantPool::addEnemy) as
+ * chunk population used to, and once through the batch functions it uses
+ * now. The last rows time whole chunks and boards.
+ */
+
+namespace {
+
+/// Values per batch; one chunk holds 4096 squares.
+constexpr size_t BATCH = 4096;
+
+/// Batches per measurement.
+constexpr int REPEATS = 500;
+
+/// Prints one result row.
+void print(const char *what, double seconds, double units, const char *unit)
+{
+    std::cout << std::left << std::setw(28) << what << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << seconds * 1e9 / units << " ns/" << unit << "\n";
+}
+
+} // namespace
+
+void Benchmarks::batch()
+{
+    std::mt19937 gen(2024);
+    const double values = static_cast<double>(BATCH) * REPEATS;
+
+    std::vector<std::uint8_t> codes(BATCH);
+    auto start = Clock::now();
+    for (int r = 0; r < REPEATS; ++r) {
+        for (size_t i = 0; i < BATCH; ++i) codes[i] = static_cast<std::uint8_t>(Utility::randInt(gen, 0, 99));
+        consume(codes[r % BATCH]);
+    }
+    print("race/kind codes, single", secondsSince(start), values, "value");
+    start = Clock::now();
+    for (int r = 0; r < REPEATS; ++r) {
+        Utility::randIntBatch(gen, 0, 99, codes.data(), BATCH);
+        consume(codes[r % BATCH]);
+    }
+    print("race/kind codes, batch", secondsSince(start), values, "value");
+
+    std::vector<const Item *> items(BATCH);
+    start = Clock::now();
+    for (int r = 0; r < REPEATS; ++r) {
+        for (size_t i = 0; i < BATCH; ++i) items[i] = ItemFactory::randomItem(gen);
+        consume(reinterpret_cast<std::uintptr_t>(items[r % BATCH]));
+    }
+    print("items, single", secondsSince(start), values, "item");
+    start = Clock::now();
+    for (int r = 0; r < REPEATS; ++r) {
+        ItemFactory::generate(gen, BATCH, items.data());
+        consume(reinterpret_cast<std::uintptr_t>(items[r % BATCH]));
+    }
+    print("items, batch", secondsSince(start), values, "item");
+
+    constexpr int POOLS = 100;
+    const double enemies = static_cast<double>(BATCH) * POOLS;
+    std::vector<std::uint32_t> ids(BATCH);
+    double seconds = 0.0;
+    for (int r = 0; r < POOLS; ++r) {
+        OccupantPool pool;
+        start = Clock::now();
+        for (size_t i = 0; i < BATCH; ++i) ids[i] = pool.addEnemy(Utility::randInt(gen, 0, Constants::RACE_COUNT - 1));
+        seconds += secondsSince(start);
+        consume(pool.enemyCount());
+    }
+    print("enemies into a pool, single", seconds, enemies, "enemy");
+    seconds = 0.0;
+    for (int r = 0; r < POOLS; ++r) {
+        OccupantPool pool;
+        start = Clock::now();
+        pool.generateEnemies(gen, BATCH, ids.data());
+        seconds += secondsSince(start);
+        consume(pool.enemyCount());
+    }
+    print("enemies into a pool, batch", seconds, enemies, "enemy");
+
+    // Every recordAt below lands in a new chunk of a CHUNKED board
+    constexpr int CHUNKS = 256;
+    Board chunked(CHUNKS * Board::CHUNK_SIZE, Board::CHUNK_SIZE, BoardMode::CHUNKED, 5);
+    start = Clock::now();
+    for (int c = 0; c < CHUNKS; ++c) consume(chunked.recordAt(c * Board::CHUNK_SIZE, 0).kind);
+    std::cout << std::left << std::setw(28) << "one CHUNKED chunk" << std::right << std::setw(10)
+              << secondsSince(start) * 1e6 / CHUNKS << " us/chunk\n";
+
+    for (const int size : {2000, 4000}) {
+        Board dense(size, size, BoardMode::DENSE, 5);
+        start = Clock::now();
+        dense.initialize(1);
+        std::cout << "DENSE initialize " << size << "x" << std::left << std::setw(11) << size << std::right
+                  << std::setprecision(3) << std::setw(10) << secondsSince(start) << " s\n"
+                  << std::setprecision(1);
+    }
+}
@@ -0,0 +1,59 @@
+#include "Benchmarks.h"
+#include <cstring>
+#include <iostream>
+
+/**
+ * @file BenchMain.cpp
+ * @brief Entry point of the Benchmarks program: runs the benchmarks named on the command line.
+ *
+ * Usage: Benchmarks [name...]   (no names, or "all", runs every benchmark)
+ */
+
+namespace {
+
+/// A benchmark that can be selected by name.
+struct Entry {
+    const char *name;
+    const char *description;
+    void (*run)();
+};
+
+constexpr Entry BENCHMARKS[] = {
+    {"generation", "dense board population against thread count", Benchmarks::generation},
+    {"layout", "square access patterns in row-major and Morton layouts", Benchmarks::layout},
+    {"arena", "enemy storage in slab arenas and board create/destroy cycles", Benchmarks::arena},
+    {"batch", "batched world generation against one draw per square", Benchmarks::batch},
+    {"dispatch", "race defence reaction dispatch and attacks", Benchmarks::dispatch},
+};
+
+/// Sink for Benchmarks::consume(); volatile so the stores are kept.
+volatile std::uint64_t consumed = 0;
+
+} // namespace
+
+void Benchmarks::consume(std::uint64_t value)
+{
+    consumed = consumed + value;
+}
+
+int main(int argc, char *argv[])
+{
+    const bool all = argc < 2 || std::strcmp(argv[1], "all") == 0;
+    int ran = 0;
+    for (const Entry &entry : BENCHMARKS) {
+        bool selected = all;
+        for (int i = 1; i < argc && !selected; ++i) selected = std::strcmp(argv[i], entry.name) == 0;
+        if (!selected) continue;
+        std::cout << "== " << entry.name << ": " << entry.description << "\n";
+        entry.run();
+        std::cout << "\n";
+        ++ran;
+    }
+
+    if (ran == 0) {
+        std::cout << "Usage: " << argv[0] << " [name...]\nBenchmarks:\n";
+        for (const Entry &entry : BENCHMARKS) std::cout << "  " << entry.name << " - " << entry.description << "\n";
+        return 1;
+    }
+    return 0;
+}
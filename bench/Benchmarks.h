@@ -0,0 +1,50 @@
+/**
+ * @file Benchmarks.h
+ * @brief Declares the benchmarks run by the Benchmarks program and the timing helper they share.
+ *
+ * Each benchmark prints a small table to std::cout. The numbers depend on the
+ * machine (core count, cache sizes, allocator), so they are for comparing
+ * variants on one machine, not for comparing machines.
+ */
+
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+#include <chrono>
+#include <cstdint>
+
+namespace Benchmarks {
+
+/// Clock used for all timings.
+using Clock = std::chrono::steady_clock;
+
+/// @return Seconds elapsed since start.
+inline double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Keeps a computed value alive so the optimiser cannot drop the work behind it.
+ * @param value Value to consume.
+ */
+void consume(std::uint64_t value);
+
+/// Dense board population time against worker thread count (Board::initialize).
+void generation();
+
+/// Square access patterns under the row-major and Morton SquareGrid layouts.
+void layout();
+
+/// Enemy construction and destruction in a SlabArena against individual heap allocations.
+void arena();
+
+/// Batched random draws, items and enemies against one draw at a time; chunk and board generation.
+void batch();
+
+/// Race defence reaction lookup against name comparisons, and whole attacks.
+void dispatch();
+
+} // namespace Benchmarks
+
+#endif // BENCHMARKS_H
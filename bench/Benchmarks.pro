@@ -0,0 +1,24 @@
+# Benchmarks behind the performance figures quoted in the commit history.
+# Build with optimisation and run, e.g.:
+#   qmake CONFIG+=release bench/Benchmarks.pro && make && ./Benchmarks generation
+# Run without arguments for every benchmark.
+
+TEMPLATE = app
+TARGET = Benchmarks
+CONFIG += console c++17
+CONFIG -= app_bundle
+CONFIG -= qt
+CONFIG += thread
+
+include(../FantasyBoardGame.pri)
+
+SOURCES += \
+        ArenaBench.cpp \
+        BatchBench.cpp \
+        BenchMain.cpp \
+        DispatchBench.cpp \
+        GenerationBench.cpp \
+        LayoutBench.cpp
+
+HEADERS += \
+    Benchmarks.h
@@ -0,0 +1,93 @@
+#include "Benchmarks.h"
+#include "Constants.h"
+#include "Enemy.h"
+#include "Player.h"
+#include "Utility.h"
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file DispatchBench.cpp
+ * @brief Times the race defence reaction lookup and whole attacks.
+ *
+ * The lookup is compared with the race-name comparisons that the Enemy and
+ * Player overrides of handleSuccessfulDefence used to make, reproduced here
+ * as reactionByName(). Whole attacks go through Character::resolveAttack for
+ * every player race against every enemy race, by day and by night.
+ */
+
+namespace {
+
+/**
+ * @brief The former dispatch: compare the race name against each race in turn.
+ * @param race Race name.
+ * @param night True at night.
+ * @return The reaction.
+ */
+Constants::DefenceReaction reactionByName(std::string_view race, bool night)
+{
+    if (race == "Human" || race == "Dwarf") return Constants::DefenceReaction::NONE;
+    if (race == "Elf") return Constants::DefenceReaction::HEAL;
+    if (race == "Hobbit") return Constants::DefenceReaction::RANDOM_DAMAGE;
+    if (race == "Orc") return night ? Constants::DefenceReaction::HEAL : Constants::DefenceReaction::COUNTER;
+    return Constants::DefenceReaction::NONE;
+}
+
+} // namespace
+
+void Benchmarks::dispatch()
+{
+    constexpr int LOOKUPS = 1 << 24;
+    std::vector<std::uint8_t> races(LOOKUPS);
+    std::mt19937 gen(21);
+    Utility::randIntBatch(gen, 0, Constants::RACE_COUNT - 1, races.data(), races.size());
+
+    std::uint64_t sum = 0;
+    auto start = Clock::now();
+    for (int i = 0; i < LOOKUPS; ++i) {
+        sum += static_cast<std::uint64_t>(reactionByName(Constants::RACE_NAMES[races[i]], i & 1));
+    }
+    const double byName = secondsSince(start);
+    start = Clock::now();
+    for (int i = 0; i < LOOKUPS; ++i) {
+        sum += static_cast<std::uint64_t>(Constants::defenceReaction(static_cast<Constants::Race>(races[i]), i & 1));
+    }
+    const double byTable = secondsSince(start);
+    consume(sum);
+
+    std::cout << std::fixed << std::setprecision(2) << "reaction lookup, ns each\n"
+              << "  race-name comparisons " << std::setw(7) << byName * 1e9 / LOOKUPS << "\n"
+              << "  RACE_TRAITS table     " << std::setw(7) << byTable * 1e9 / LOOKUPS << "\n";
+
+    constexpr int ATTACKS = 1000000;
+    const int pairs = Constants::RACE_COUNT * Constants::RACE_COUNT * 2;
+    int attacks = 0;
+    double seconds = 0.0;
+    for (int i = 0; i < pairs; ++i) {
+        const bool night = i % 2 != 0;
+        Utility::setNight(night);
+        Player player(static_cast<Constants::Race>(i / 2 / Constants::RACE_COUNT), 0, 0);
+        Enemy enemy(i / 2 % Constants::RACE_COUNT);
+        player.updateForTime(night);
+        enemy.updateForTime(night);
+        const int playerHealth = player.getHealth(), enemyHealth = enemy.getHealth();
+
+        start = Clock::now();
+        for (int n = 0; n < ATTACKS / pairs; ++n) {
+            sum += static_cast<std::uint64_t>(player.resolveAttack(enemy).damage);
+            sum += static_cast<std::uint64_t>(enemy.resolveAttack(player).damage);
+            // Keep both alive so every attack is a full one
+            player.setHealth(playerHealth);
+            enemy.setHealth(enemyHealth);
+        }
+        seconds += secondsSince(start);
+        attacks += 2 * (ATTACKS / pairs);
+    }
+    Utility::setNight(false);
+    consume(sum);
+    std::cout << "resolveAttack, all races day and night: " << std::setprecision(1) << seconds * 1e9 / attacks
+              << " ns per attack\n";
+}
@@ -0,0 +1,47 @@
+#include "Benchmarks.h"
+#include "Board.h"
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+/**
+ * @file GenerationBench.cpp
+ * @brief Times Board::initialize on a DENSE board with 1, 2, 4 and 8 worker threads.
+ *
+ * Every run uses the same seed; a hash of all square records shows that the
+ * generated world does not depend on the thread count. How the time scales
+ * with the thread count has not been measured: so far the benchmark has only
+ * run on a single-core host, where 1, 2 and 4 threads all took about 2.5 s.
+ */
+
+/// @return FNV-1a hash of every square record of the board.
+static std::uint64_t boardHash(const Board &board)
+{
+    std::uint64_t hash = 1469598103934665603ULL;
+    for (int y = 0; y < board.getHeight(); ++y) {
+        for (int x = 0; x < board.getWidth(); ++x) {
+            const SquareRecord r = board.recordAt(x, y);
+            for (const std::uint64_t v : {std::uint64_t{r.kind}, std::uint64_t{r.code}, static_cast<std::uint64_t>(r.health)}) {
+                hash = (hash ^ v) * 1099511628211ULL;
+            }
+        }
+    }
+    return hash;
+}
+
+void Benchmarks::generation()
+{
+    constexpr int SIZE = 4096;
+    constexpr std::uint64_t SEED = 99;
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << "\n"
+              << SIZE << "x" << SIZE << " DENSE board, seed " << SEED << "\n"
+              << "threads  seconds  board hash\n";
+    for (const unsigned threads : {1u, 2u, 4u, 8u}) {
+        Board board(SIZE, SIZE, BoardMode::DENSE, SEED);
+        const auto start = Clock::now();
+        board.initialize(threads);
+        const double seconds = secondsSince(start);
+        std::cout << std::setw(7) << threads << "  " << std::fixed << std::setprecision(3) << std::setw(7) << seconds
+                  << "  " << std::hex << boardHash(board) << std::dec << "\n";
+    }
+}
@@ -0,0 +1,117 @@
+#include "Benchmarks.h"
+#include "SquareGrid.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+/**
+ * @file LayoutBench.cpp
+ * @brief Compares the access patterns of SquareGrid under RowMajorLayout and MortonLayout.
+ *
+ * Both layouts are instantiated directly, so one build measures both
+ * whatever FBG_MORTON_LAYOUT is set to. Each pattern reads squares only:
+ *  - walk:   a random N/S/E/W walk, one square per step
+ *  - window: the 9x9 neighbourhood around random squares
+ *  - column: every square, column by column
+ *  - row:    every square, row by row
+ */
+
+namespace {
+
+/// Small, fast random stream for picking walk steps and window centres.
+struct Lcg {
+    std::uint64_t state;
+
+    std::uint32_t next() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    }
+};
+
+/// Nanoseconds per unit of work for each access pattern.
+struct Timings {
+    double walk;
+    double window;
+    double column;
+    double row;
+};
+
+/**
+ * @brief Runs every access pattern over an n x n grid in the given layout.
+ * @param n Side of the board.
+ * @return The timings.
+ */
+template <typename Layout>
+Timings measure(int n)
+{
+    constexpr int STEPS = 4000000;
+    constexpr int WINDOWS = 200000;
+    constexpr int RADIUS = 4;
+
+    SquareGrid<Layout> grid;
+    grid.resize(n, n);
+    Timings t{};
+    std::uint64_t seen = 0;
+    Lcg rng{12345};
+
+    auto start = Benchmarks::Clock::now();
+    int x = n / 2, y = n / 2;
+    for (int i = 0; i < STEPS; ++i) {
+        switch (rng.next() & 3) {
+        case 0: y = std::max(y - 1, 0); break;
+        case 1: y = std::min(y + 1, n - 1); break;
+        case 2: x = std::min(x + 1, n - 1); break;
+        default: x = std::max(x - 1, 0); break;
+        }
+        seen += grid.at(x, y).hasEnemy();
+    }
+    t.walk = Benchmarks::secondsSince(start) * 1e9 / STEPS;
+
+    start = Benchmarks::Clock::now();
+    for (int i = 0; i < WINDOWS; ++i) {
+        const int cx = static_cast<int>(rng.next() % static_cast<std::uint32_t>(n));
+        const int cy = static_cast<int>(rng.next() % static_cast<std::uint32_t>(n));
+        for (int wy = std::max(cy - RADIUS, 0); wy <= std::min(cy + RADIUS, n - 1); ++wy) {
+            for (int wx = std::max(cx - RADIUS, 0); wx <= std::min(cx + RADIUS, n - 1); ++wx) {
+                seen += grid.at(wx, wy).hasEnemy();
+            }
+        }
+    }
+    t.window = Benchmarks::secondsSince(start) * 1e9 / WINDOWS;
+
+    const double squares = static_cast<double>(n) * n;
+    start = Benchmarks::Clock::now();
+    for (int cx = 0; cx < n; ++cx) {
+        for (int cy = 0; cy < n; ++cy) seen += grid.at(cx, cy).hasEnemy();
+    }
+    t.column = Benchmarks::secondsSince(start) * 1e9 / squares;
+
+    start = Benchmarks::Clock::now();
+    for (int cy = 0; cy < n; ++cy) {
+        for (int cx = 0; cx < n; ++cx) seen += grid.at(cx, cy).hasEnemy();
+    }
+    t.row = Benchmarks::secondsSince(start) * 1e9 / squares;
+
+    Benchmarks::consume(seen);
+    return t;
+}
+
+/// Prints one table row.
+void print(int n, const char *layout, const Timings &t)
+{
+    std::cout << std::setw(5) << n << "  " << std::left << std::setw(9) << layout << std::right << std::fixed
+              << std::setprecision(1) << std::setw(10) << t.walk << std::setw(12) << t.window << std::setw(16)
+              << t.column << std::setw(14) << t.row << "\n";
+}
+
+} // namespace
+
+void Benchmarks::layout()
+{
+    std::cout << "ns per unit\n"
+              << "    n  layout     walk/step  9x9 window  column sweep/sq  row sweep/sq\n";
+    for (const int n : {512, 2048, 4096, 8192}) {
+        print(n, "row-major", measure<RowMajorLayout>(n));
+        print(n, "morton", measure<MortonLayout>(n));
+    }
+}
@@ -1,159 +1,270 @@
-#include <iostream>
-#include <string>
-#include <cctype>
-#include "Board.h"
-#include "Player.h"
-#include "Utility.h"
-#include "Constants.h"
-
-/**
- * @file main.cpp
- * @brief Entry point for the Fantasy Board Game console application.
- *
- * Responsibilities:
- *  - Set up the game board and player.
- *  - Handle user input commands (movement, inventory, combat).
- *  - Manage day/night cycles and game loop.
- */
-
-/**
- * @brief Prints a welcome message and basic game commands.
- */
-static void printWelcome()
-{
-    std::cout << "======================================\n";
-    std::cout << "  Fantasy Board Game (Console)       \n";
-    std::cout << "======================================\n";
-    std::cout << "Commands: N,S,E,W (move), L=look, P=pick, D=drop, A=attack, I=inventory, X=exit\n";
-}
-
-/**
- * @brief Main function for the game.
- *
- * Initializes board and player, then enters the game loop handling commands:
- *  - Movement: N/S/E/W
- *  - Look: L
- *  - Pick up item: P
- *  - Drop item: D
- *  - Attack enemy: A
- *  - Show inventory: I
- *  - Exit: X
- *
- * Also updates day/night cycles after a set number of commands.
- *
- * @return 0 on normal termination.
- */
-int main()
-{
-    printWelcome();
-
-    int width = 0, height = 0;
-    std::cout << "Enter board width (columns): ";
-    std::cin >> width;
-    std::cout << "Enter board height (rows): ";
-    std::cin >> height;
-
-    if (width <= 0 || height <= 0) {
-        std::cout << "Invalid board size. Exiting.\n";
-        return 0;
-    }
-    std::string raceStr;
-
-    bool charecheck{false};
-    do{
-    // ask for player's race
-    std::cout << "Enter your character name to choose your race (Human / Elf / Dwarf / Hobbit / Orc): ";
-    std::cin >> raceStr;
-    raceStr[0] = std::toupper(raceStr[0]);
-    for (size_t i = 1; i < raceStr.size(); i++) raceStr[i] = std::tolower(raceStr[i]);
-    if (raceStr == "Human" ||
-        raceStr == "Elf" ||
-        raceStr == "Dwarf" ||
-        raceStr == "Hobbit" ||
-        raceStr == "Orc")
-    {
-        charecheck = true;
-    }
-    else {
-        std::cout << "Invalid race. Please try again.\n";
-    }
-    }while(charecheck == false);
-
-
-    std::cout << "Choosen charecter is "<< raceStr<<std::endl;
-    Player player(raceStr, 0, 0);
-
-    Board board(width, height);
-    board.initialize();
-
-    board.lookAtPlayerSquare(player);
-
-    int commandCount = 0;
-    bool running = true;
-
-    while (running && player.isAlive()) {
-        std::cout << "\nEnter command: ";
-        std::string cmd; std::cin >> cmd;
-        if (cmd.empty()) continue;
-
-        char c = static_cast<char>(std::toupper(cmd[0]));
-        bool known = true;
-
-        switch (c) {
-        case 'N':
-        case 'S':
-        case 'E':
-        case 'W':
-            board.movePlayer(player, c);
-            break;
-        case 'L':
-            board.lookAtPlayerSquare(player);
-            break;
-        case 'P':
-            board.playerPickUp(player);
-            break;
-        case 'D': {
-            auto item = player.selectItemToDrop();
-            if (item) {
-                // Keep a backup raw pointer in case drop fails
-                Item* rawBackup = item.get();
-
-                if (!board.playerDrop(player, std::move(item))) {
-                    // Restore ownership using the backup pointer
-                    player.returnDroppedItem(std::unique_ptr<Item>(rawBackup));
-                    std::cout << "Drop failed. Item returned.\n";
-                }
-            }
-        } break;
-        case 'A':
-            board.playerAttack(player);
-            break;
-        case 'I':
-            player.showInventory();
-            break;
-        case 'X':
-            running = false;
-            break;
-        default:
-            std::cout << "Unknown command.\n";
-            known = false;
-        }
-
-        if (known) {
-                ++commandCount;            
-            // Show player's current position
-            std::cout << "You are at (" << player.getX() << ", " << player.getY() << ").\n";
-
-            if (commandCount % Constants::COMMANDS_PER_TIME_SWITCH == 0) {
-                Utility::toggleDayNight();
-                bool night = Utility::isNight();
-                std::cout << "Time changed. It is now " << (night ? "Night" : "Day") << ".\n";
-                player.updateForTime(night);
-            }
-        }
-    }
-
-
-    std::cout << "\nGame over. You collected " << player.getGold() << " gold.\n";
-    return 0;
-}
+#include <iostream>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <cctype>
+#include <cstdlib>
+#include "BalanceSimulator.h"
+#include "Board.h"
+#include "Player.h"
+#include "SaveGame.h"
+#include "Utility.h"
+#include "Constants.h"
+#include "WorldTemplate.h"
+
+/**
+ * @file main.cpp
+ * @brief Entry point for the Fantasy Board Game console application.
+ *
+ * Responsibilities:
+ *  - Set up the game board and player, or load them from a save file.
+ *  - Write world templates, or play on a shared, memory-mapped one.
+ *  - Print race matchup win rates for balance work.
+ *  - Handle user input commands (movement, inventory, combat).
+ *  - Manage day/night cycles and game loop.
+ */
+
+/**
+ * @brief Prints a welcome message and basic game commands.
+ */
+static void printWelcome()
+{
+    std::cout << "======================================\n";
+    std::cout << "  Fantasy Board Game (Console)       \n";
+    std::cout << "======================================\n";
+    std::cout << "Commands: N,S,E,W (move), L=look, P=pick, D=drop, A=attack, F=fight to the end, I=inventory, V=save, X=exit\n";
+}
+
+/**
+ * @brief Main function for the game.
+ *
+ * Initializes board and player, then enters the game loop handling commands:
+ *  - Movement: N/S/E/W
+ *  - Look: L
+ *  - Pick up item: P
+ *  - Drop item: D
+ *  - Attack enemy: A
+ *  - Fight enemy to the end: F
+ *  - Show inventory: I
+ *  - Save game: V
+ *  - Exit: X
+ *
+ * Also updates day/night cycles after a set number of commands.
+ *
+ * Command-line options:
+ *  - --make-template <file> <width> <height>: generate a world, write it as a
+ *    template file and exit.
+ *  - --template <file>: play on the given template instead of a new random board.
+ *    A saved game is not offered for loading in this case.
+ *  - --balance [fights]: simulate every race matchup (default 100000 fights
+ *    each), print the win-rate matrices and exit.
+ *
+ * @param argc Argument count.
+ * @param argv Arguments.
+ * @return 0 on normal termination.
+ */
+int main(int argc, char *argv[])
+{
+    const std::string option = argc > 1 ? argv[1] : "";
+    if (option == "--make-template") {
+        const int width = argc > 3 ? std::atoi(argv[3]) : 0;
+        const int height = argc > 4 ? std::atoi(argv[4]) : 0;
+        if (width <= 0 || height <= 0) {
+            std::cout << "Usage: " << argv[0] << " --make-template <file> <width> <height>\n";
+            return 1;
+        }
+        Board world(width, height, BoardMode::CHUNKED);
+        if (!WorldTemplate::write(argv[2], world)) {
+            std::cout << "Could not write template " << argv[2] << ".\n";
+            return 1;
+        }
+        std::cout << "Wrote " << width << "x" << height << " template to " << argv[2] << ".\n";
+        return 0;
+    }
+
+    if (option == "--balance") {
+        const long long fights = argc > 2 ? std::atoll(argv[2]) : 100000;
+        if (fights <= 0) {
+            std::cout << "Usage: " << argv[0] << " --balance [fights per matchup]\n";
+            return 1;
+        }
+        const auto results = BalanceSimulator::simulateAll(static_cast<std::uint64_t>(fights), Utility::randomSeed());
+        std::cout << "Simulated " << fights << " fights for each of " << results.size() << " matchups.\n";
+        BalanceSimulator::printMatrix(std::cout, results);
+        return 0;
+    }
+
+    std::shared_ptr<const WorldTemplate> world;
+    if (option == "--template") {
+        world = argc > 2 ? WorldTemplate::open(argv[2]) : nullptr;
+        if (!world) {
+            std::cout << "Could not open template " << (argc > 2 ? argv[2] : "") << ".\n";
+            return 1;
+        }
+    }
+
+    printWelcome();
+
+    std::unique_ptr<Board> board;
+    std::unique_ptr<Player> player;
+
+    if (std::ifstream(Constants::SAVE_FILE_NAME) && world) {
+        std::cout << "A saved game was found but is ignored: playing on the template given with --template.\n";
+    } else if (std::ifstream(Constants::SAVE_FILE_NAME)) {
+        std::cout << "A saved game was found. Load it? (y/n): ";
+        std::string answer;
+        std::cin >> answer;
+        if (!answer.empty() && std::toupper(answer[0]) == 'Y') {
+            if (SaveGame::load(Constants::SAVE_FILE_NAME, board, player)) {
+                std::cout << "Game loaded.\n";
+            } else {
+                std::cout << "Could not load the saved game. Starting a new one.\n";
+            }
+        }
+    }
+
+    if (!board) {
+        int width = world ? world->getWidth() : 0;
+        int height = world ? world->getHeight() : 0;
+        if (!world) {
+            std::cout << "Enter board width (columns): ";
+            std::cin >> width;
+            std::cout << "Enter board height (rows): ";
+            std::cin >> height;
+        }
+
+        if (width <= 0 || height <= 0) {
+            std::cout << "Invalid board size. Exiting.\n";
+            return 0;
+        }
+        std::string raceStr;
+
+        bool charecheck{false};
+        do{
+        // ask for player's race
+        std::cout << "Enter your character name to choose your race (";
+        for (int r = 0; r < Constants::RACE_COUNT; ++r) {
+            std::cout << (r ? " / " : "") << Constants::RACE_NAMES[r];
+        }
+        std::cout << "): ";
+        std::cin >> raceStr;
+        raceStr[0] = std::toupper(raceStr[0]);
+        for (size_t i = 1; i < raceStr.size(); i++) raceStr[i] = std::tolower(raceStr[i]);
+        if (Constants::raceIndex(raceStr) >= 0)
+        {
+            charecheck = true;
+        }
+        else {
+            std::cout << "Invalid race. Please try again.\n";
+        }
+        }while(charecheck == false);
+
+
+        std::cout << "Choosen charecter is "<< raceStr<<std::endl;
+        player = std::make_unique<Player>(raceStr, 0, 0);
+
+        const bool large = static_cast<long long>(width) * height > Constants::MAX_DENSE_SQUARES;
+        if (world) {
+            board = std::make_unique<Board>(world);
+            std::cout << "Playing on a " << width << "x" << height << " world template.\n";
+        } else {
+            board = std::make_unique<Board>(width, height, large ? BoardMode::CHUNKED : BoardMode::DENSE);
+            if (large) {
+                std::cout << "Large board: the world is generated as you explore it.\n";
+            }
+        }
+        board->initialize();
+    }
+
+    board->lookAtPlayerSquare(*player);
+
+    int commandCount = 0;
+    bool running = true;
+
+    while (running && player->isAlive()) {
+        std::cout << "\nEnter command: ";
+        std::string cmd; std::cin >> cmd;
+        if (cmd.empty()) continue;
+
+        char c = static_cast<char>(std::toupper(cmd[0]));
+        bool known = true;
+
+        switch (c) {
+        case 'N':
+        case 'S':
+        case 'E':
+        case 'W':
+            board->movePlayer(*player, c);
+            break;
+        case 'L':
+            board->lookAtPlayerSquare(*player);
+            break;
+        case 'P':
+            board->playerPickUp(*player);
+            break;
+        case 'D': {
+            const Item *item = player->selectItemToDrop();
+            if (item) {
+                // On failure the board leaves the item with us, so it can go straight back
+                if (!board->playerDrop(*player, item)) {
+                    player->returnDroppedItem(item);
+                    std::cout << "Drop failed. Item returned.\n";
+                }
+            }
+        } break;
+        case 'A':
+            board->playerAttack(*player);
+            break;
+        case 'F': {
+            const FightSummary fight = board->playerFight(*player);
+            if (!fight.fought) {
+                std::cout << "There is no enemy here to fight.\n";
+                break;
+            }
+            std::cout << "The fight lasted " << fight.rounds << (fight.rounds == 1 ? " round" : " rounds")
+                      << ": you dealt " << fight.damageDealt
+                      << " damage and took " << fight.damageTaken << ".\n";
+            if (fight.won) {
+                std::cout << "Enemy defeated! You gained " << fight.gold << " gold.\n";
+            } else if (fight.lost) {
+                std::cout << "You have been defeated! Game over.\n";
+            } else {
+                std::cout << "Neither of you can win this fight. You break it off.\n";
+            }
+        } break;
+        case 'I':
+            player->showInventory();
+            break;
+        case 'V':
+            if (SaveGame::save(Constants::SAVE_FILE_NAME, *board, *player)) {
+                std::cout << "Game saved to " << Constants::SAVE_FILE_NAME << ".\n";
+            } else {
+                std::cout << "Could not save the game.\n";
+            }
+            break;
+        case 'X':
+            running = false;
+            break;
+        default:
+            std::cout << "Unknown command.\n";
+            known = false;
+        }
+
+        if (known) {
+                ++commandCount;            
+            // Show player's current position
+            std::cout << "You are at (" << player->getX() << ", " << player->getY() << ").\n";
+
+            if (commandCount % Constants::COMMANDS_PER_TIME_SWITCH == 0) {
+                Utility::toggleDayNight();
+                bool night = Utility::isNight();
+                std::cout << "Time changed. It is now " << (night ? "Night" : "Day") << ".\n";
+                player->updateForTime(night);
+            }
+        }
+    }
+
+
+    std::cout << "\nGame over. You collected " << player->getGold() << " gold.\n";
+    return 0;
+}
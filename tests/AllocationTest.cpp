@@ -0,0 +1,167 @@
+/**
+ * @file AllocationTest.cpp
+ * @brief Checks that looking at squares never allocates heap memory.
+ *
+ * Global operator new is replaced by a counting version. After a warm-up
+ * pass (which may fill the CombatOdds memo and the chunks of a CHUNKED
+ * board), every square of a DENSE, a CHUNKED and a TEMPLATE board is looked
+ * at by day and by night through Board::lookAtPlayerSquare, and every kind
+ * of SquareRecord through BoardSquare::look. Any allocation in those passes
+ * fails the test.
+ *
+ * Exits with status 0 if every check passes.
+ */
+
+#include "Board.h"
+#include "BoardSquare.h"
+#include "Constants.h"
+#include "ItemFactory.h"
+#include "Player.h"
+#include "Utility.h"
+#include "WorldTemplate.h"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <streambuf>
+
+/// Heap allocations made while counting is switched on.
+static size_t allocations = 0;
+
+/// Whether operator new currently counts.
+static bool counting = false;
+
+void *operator new(size_t size)
+{
+    if (counting) ++allocations;
+    if (void *p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+void operator delete[](void *p, size_t) noexcept { std::free(p); }
+
+/// Temporary template file used for the TEMPLATE board.
+static const char *const TEMPLATE_PATH = "allocation_test.fbgt";
+
+/**
+ * @brief Stream buffer that discards everything without allocating,
+ *        unlike the string buffer of an ostringstream.
+ */
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
+
+/**
+ * @brief Looks at every square of a board by day and by night.
+ * @param board Board to look at.
+ * @return Heap allocations made by the second round of looks.
+ */
+static size_t lookEverywhere(const Board &board)
+{
+    Player player(Constants::Race::HUMAN, 0, 0);
+    auto pass = [&]() {
+        for (const bool night : {false, true}) {
+            Utility::setNight(night);
+            for (int y = 0; y < board.getHeight(); ++y) {
+                for (int x = 0; x < board.getWidth(); ++x) {
+                    player.setPosition(x, y);
+                    board.lookAtPlayerSquare(player);
+                }
+            }
+        }
+    };
+
+    pass();
+    allocations = 0;
+    counting = true;
+    pass();
+    counting = false;
+    return allocations;
+}
+
+/// @return Heap allocations made by looking at every kind of stored record.
+static size_t lookAtRecords()
+{
+    char line[BoardSquare::LOOK_BUFFER_SIZE];
+    allocations = 0;
+    counting = true;
+    for (const bool night : {false, true}) {
+        Utility::setNight(night);
+        BoardSquare::look(SquareRecord{}, line, sizeof(line));
+        for (int race = 0; race < Constants::RACE_COUNT; ++race) {
+            SquareRecord record;
+            record.kind = SquareRecord::ENEMY;
+            record.code = static_cast<std::uint8_t>(race);
+            record.health = 42;
+            BoardSquare::look(record, line, sizeof(line));
+        }
+        for (int kind = 0; kind < ItemFactory::ITEM_KIND_COUNT; ++kind) {
+            SquareRecord record;
+            record.kind = SquareRecord::ITEM;
+            record.code = static_cast<std::uint8_t>(kind);
+            BoardSquare::look(record, line, sizeof(line));
+        }
+    }
+    counting = false;
+    return allocations;
+}
+
+int main()
+{
+    // The counter must see allocations at all for a zero to mean anything
+    counting = true;
+    int *volatile probe = new int(0);
+    delete probe;
+    counting = false;
+    if (allocations != 1) {
+        std::cerr << "operator new is not being counted.\n";
+        return 1;
+    }
+
+    NullBuffer discard;
+    std::streambuf *console = std::cout.rdbuf(&discard);
+
+    Board dense(256, 256, BoardMode::DENSE, 11);
+    dense.initialize();
+    Board chunked(256, 256, BoardMode::CHUNKED, 12);
+    chunked.initialize();
+    const bool written = WorldTemplate::write(TEMPLATE_PATH, chunked);
+    std::shared_ptr<const WorldTemplate> world = written ? WorldTemplate::open(TEMPLATE_PATH) : nullptr;
+    std::remove(TEMPLATE_PATH);
+
+    const size_t denseAllocations = lookEverywhere(dense);
+    const size_t chunkedAllocations = lookEverywhere(chunked);
+    const size_t templateAllocations = world ? lookEverywhere(Board(world)) : 0;
+    const size_t recordAllocations = lookAtRecords();
+    std::cout.rdbuf(console);
+
+    int failures = 0;
+    auto report = [&failures](const char *what, size_t count) {
+        if (count == 0) return;
+        std::cerr << what << ": " << count << " heap allocation(s).\n";
+        ++failures;
+    };
+    if (!world) {
+        std::cerr << "Could not write or map " << TEMPLATE_PATH << ".\n";
+        ++failures;
+    }
+    report("DENSE board looks", denseAllocations);
+    report("CHUNKED board looks", chunkedAllocations);
+    report("TEMPLATE board looks", templateAllocations);
+    report("record looks", recordAllocations);
+
+    if (failures) return 1;
+    std::cout << "Looking at squares made no heap allocations.\n";
+    return 0;
+}
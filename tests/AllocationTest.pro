@@ -0,0 +1,16 @@
+# Checks that looking at squares (BoardSquare::look, Board::lookAtPlayerSquare)
+# makes no heap allocations. Build and run:
+#   qmake tests/AllocationTest.pro && make && ./AllocationTest
+# The program exits with status 0 if no look allocated.
+
+TEMPLATE = app
+TARGET = AllocationTest
+CONFIG += console c++17
+CONFIG -= app_bundle
+CONFIG -= qt
+CONFIG += thread
+
+include(../FantasyBoardGame.pri)
+
+SOURCES += \
+        AllocationTest.cpp
@@ -0,0 +1,280 @@
+/**
+ * @file SaveGameTest.cpp
+ * @brief Round-trip and corruption tests for the binary save format.
+ *
+ * Covers:
+ *  - DENSE and CHUNKED boards saved and loaded back square for square.
+ *  - A complete save file (board, player, day/night flag) through SaveGame.
+ *  - Truncated files and hostile headers, which must be rejected without
+ *    throwing or allocating the board they describe.
+ *
+ * Exits with status 0 if every check passes.
+ */
+
+#include "BinaryIO.h"
+#include "Board.h"
+#include "Constants.h"
+#include "Player.h"
+#include "SaveGame.h"
+#include "Utility.h"
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+/// Reports a failed check with its line; the test carries on.
+#define CHECK(condition)                                                               \
+    do {                                                                               \
+        if (!(condition)) {                                                            \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition "\n"; \
+            ++failures;                                                                \
+        }                                                                              \
+    } while (false)
+
+/// Temporary save file used by the SaveGame checks.
+static const char *const SAVE_PATH = "savegame_test.fbg";
+
+/**
+ * @brief Silences std::cout (game actions print messages) while in scope.
+ */
+struct QuietConsole {
+    std::ostringstream sink;
+    std::streambuf *previous = std::cout.rdbuf(sink.rdbuf());
+    ~QuietConsole() { std::cout.rdbuf(previous); }
+};
+
+/// @return true if both boards have the same size and square records.
+static bool sameSquares(const Board &a, const Board &b)
+{
+    if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight()) return false;
+    for (int y = 0; y < a.getHeight(); ++y) {
+        for (int x = 0; x < a.getWidth(); ++x) {
+            const SquareRecord ra = a.recordAt(x, y), rb = b.recordAt(x, y);
+            if (ra.kind != rb.kind || ra.code != rb.code || ra.health != rb.health) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Picks up the first item the player can carry, so the saved board
+ *        differs from what its seed regenerates.
+ * @return true if an item was taken.
+ */
+static bool takeAnItem(Board &board, Player &player)
+{
+    QuietConsole quiet;
+    int x = 0, y = 0;
+    while (board.findNextOccupant(OccupantKind::ITEM, x, y)) {
+        player.setPosition(x, y);
+        board.playerPickUp(player);
+        if (board.recordAt(x, y).kind == SquareRecord::EMPTY) return true;
+        if (++x == board.getWidth()) {
+            x = 0;
+            ++y;
+        }
+    }
+    return false;
+}
+
+/// @return Board::save() output for board.
+static std::string saved(const Board &board)
+{
+    std::ostringstream out;
+    board.save(out);
+    return out.str();
+}
+
+/// @return Board::load() of the given bytes.
+static std::unique_ptr<Board> loaded(const std::string &bytes)
+{
+    std::istringstream in(bytes);
+    return Board::load(in);
+}
+
+/// @return A board header as written by Board::save().
+static std::string header(std::int32_t width, std::int32_t height, BoardMode mode)
+{
+    std::ostringstream out;
+    BinaryIO::write(out, width);
+    BinaryIO::write(out, height);
+    BinaryIO::write(out, static_cast<std::uint8_t>(mode));
+    BinaryIO::write(out, static_cast<std::uint64_t>(1));
+    return out.str();
+}
+
+/// @return One CHUNKED save entry: chunk (cx, cy) with every square empty.
+static std::string emptyChunk(std::int32_t cx, std::int32_t cy)
+{
+    std::ostringstream out;
+    BinaryIO::write(out, cx);
+    BinaryIO::write(out, cy);
+    const std::vector<SquareRecord> records(static_cast<size_t>(Board::CHUNK_SIZE) * Board::CHUNK_SIZE);
+    BinaryIO::writeArray(out, records.data(), records.size());
+    return out.str();
+}
+
+/// @return count as a CHUNKED save's chunk count field.
+static std::string chunkCount(std::uint64_t count)
+{
+    std::ostringstream out;
+    BinaryIO::write(out, count);
+    return out.str();
+}
+
+/**
+ * @brief Checks that every listed prefix of a save is rejected.
+ * @param bytes Complete save.
+ * @param stride Distance between the prefix lengths tried.
+ */
+static void checkTruncated(const std::string &bytes, size_t stride)
+{
+    for (size_t length = 0; length < bytes.size(); length += stride) {
+        CHECK(!loaded(bytes.substr(0, length)));
+    }
+    CHECK(!loaded(bytes.substr(0, bytes.size() - 1)));
+}
+
+static void testDenseRoundTrip()
+{
+    Board board(70, 45, BoardMode::DENSE, 1234);
+    board.initialize();
+    Player player(Constants::Race::HUMAN, 0, 0);
+    CHECK(takeAnItem(board, player));
+
+    const std::string bytes = saved(board);
+    std::unique_ptr<Board> copy = loaded(bytes);
+    CHECK(copy && sameSquares(board, *copy));
+    CHECK(copy && saved(*copy) == bytes);
+    checkTruncated(bytes, 7);
+}
+
+static void testChunkedRoundTrip()
+{
+    Board board(1000, 700, BoardMode::CHUNKED, 99);
+    board.initialize();
+    board.recordAt(0, 0);
+    board.recordAt(999, 699);
+    Player player(Constants::Race::ELF, 0, 0);
+    CHECK(takeAnItem(board, player));
+
+    const std::string bytes = saved(board);
+    std::unique_ptr<Board> copy = loaded(bytes);
+    CHECK(copy && copy->generatedChunkCount() == board.generatedChunkCount());
+    // Chunks missing from the save regenerate from the seed, so every square matches
+    CHECK(copy && sameSquares(board, *copy));
+    checkTruncated(bytes, 97);
+}
+
+static void testHostileHeaders()
+{
+    // Would need tens of gigabytes if the size were believed
+    CHECK(!loaded(header(100000, 100000, BoardMode::DENSE)));
+    CHECK(!loaded(header(Constants::MAX_BOARD_SIDE + 1, 64, BoardMode::CHUNKED) + chunkCount(0)));
+    CHECK(!loaded(header(64, Constants::MAX_BOARD_SIDE + 1, BoardMode::CHUNKED) + chunkCount(0)));
+    CHECK(!loaded(header(-5, 64, BoardMode::CHUNKED) + chunkCount(0)));
+    CHECK(!loaded(header(64, 64, BoardMode::TEMPLATE)));
+
+    // A 128x64 CHUNKED board has two chunks
+    const std::string chunked = header(128, 64, BoardMode::CHUNKED);
+    CHECK(loaded(chunked + chunkCount(2) + emptyChunk(0, 0) + emptyChunk(1, 0)));
+    CHECK(!loaded(chunked + chunkCount(2) + emptyChunk(0, 0) + emptyChunk(0, 0)));
+    CHECK(!loaded(chunked + chunkCount(3) + emptyChunk(0, 0) + emptyChunk(1, 0) + emptyChunk(0, 0)));
+    CHECK(!loaded(chunked + chunkCount(~0ULL)));
+    CHECK(!loaded(chunked + chunkCount(1) + emptyChunk(2, 0)));
+    CHECK(!loaded(chunked + chunkCount(1) + emptyChunk(0, -1)));
+
+    // A 100x70 board's edge chunks reach past column 99 and row 69
+    const std::string edge = header(100, 70, BoardMode::CHUNKED) + chunkCount(1);
+    auto occupiedAt = [&edge](int lx, int ly) {
+        std::string bytes = edge + emptyChunk(1, 1);
+        const size_t record = bytes.size() - Board::CHUNK_SIZE * Board::CHUNK_SIZE * sizeof(SquareRecord)
+                              + (static_cast<size_t>(ly) * Board::CHUNK_SIZE + static_cast<size_t>(lx)) * sizeof(SquareRecord);
+        bytes[record] = SquareRecord::ITEM;
+        return bytes;
+    };
+    CHECK(loaded(occupiedAt(35, 5)));  // square (99, 69), the board's corner
+    CHECK(!loaded(occupiedAt(36, 5))); // column 100
+    CHECK(!loaded(occupiedAt(35, 6))); // row 70
+
+    std::string badRecord = chunked + chunkCount(1) + emptyChunk(0, 0);
+    badRecord[badRecord.size() - 4] = 7; // no such square kind
+    CHECK(!loaded(badRecord));
+}
+
+static void testPlayer()
+{
+    Player player(Constants::Race::DWARF, 3, 4);
+    player.addGold(17);
+    std::ostringstream out;
+    player.save(out);
+    const std::string bytes = out.str();
+
+    std::istringstream in(bytes);
+    std::unique_ptr<Player> copy = Player::load(in);
+    CHECK(copy && copy->getRaceId() == Constants::Race::DWARF && copy->getX() == 3 && copy->getY() == 4
+          && copy->getGold() == 17 && copy->getHealth() == player.getHealth());
+
+    // An item count far beyond the data must fail on the missing items, not allocate for them
+    std::string hostile = bytes;
+    const std::uint32_t huge = 0xFFFFFFFFu;
+    hostile.replace(hostile.size() - sizeof(huge), sizeof(huge), reinterpret_cast<const char *>(&huge), sizeof(huge));
+    std::istringstream hostileIn(hostile);
+    CHECK(!Player::load(hostileIn));
+
+    std::string badRace = bytes;
+    badRace[0] = static_cast<char>(Constants::RACE_COUNT);
+    std::istringstream badRaceIn(badRace);
+    CHECK(!Player::load(badRaceIn));
+}
+
+static void testSaveFile()
+{
+    Board board(50, 50, BoardMode::DENSE, 7);
+    board.initialize();
+    Player player(Constants::Race::ORC, 0, 0);
+    CHECK(takeAnItem(board, player));
+    Utility::setNight(true);
+    CHECK(SaveGame::save(SAVE_PATH, board, player));
+
+    Utility::setNight(false);
+    std::unique_ptr<Board> loadedBoard;
+    std::unique_ptr<Player> loadedPlayer;
+    CHECK(SaveGame::load(SAVE_PATH, loadedBoard, loadedPlayer));
+    CHECK(Utility::isNight());
+    CHECK(loadedBoard && sameSquares(board, *loadedBoard));
+    CHECK(loadedPlayer && loadedPlayer->getX() == player.getX() && loadedPlayer->getY() == player.getY()
+          && loadedPlayer->itemCount() == player.itemCount());
+
+    // A failed load leaves the previous game untouched
+    {
+        std::FILE *file = std::fopen(SAVE_PATH, "r+b");
+        CHECK(file && std::fputc('X', file) != EOF);
+        if (file) std::fclose(file);
+    }
+    const Board *before = loadedBoard.get();
+    CHECK(!SaveGame::load(SAVE_PATH, loadedBoard, loadedPlayer));
+    CHECK(loadedBoard.get() == before && loadedPlayer);
+    std::remove(SAVE_PATH);
+    CHECK(!SaveGame::load(SAVE_PATH, loadedBoard, loadedPlayer));
+}
+
+int main()
+{
+    testDenseRoundTrip();
+    testChunkedRoundTrip();
+    testHostileHeaders();
+    testPlayer();
+    testSaveFile();
+
+    if (failures) {
+        std::cerr << failures << " check(s) failed.\n";
+        return 1;
+    }
+    std::cout << "All save/load checks passed.\n";
+    return 0;
+}
@@ -0,0 +1,15 @@
+# Save/load round-trip and corrupt-file tests. Build and run:
+#   qmake tests/SaveGameTest.pro && make && ./SaveGameTest
+# The program exits with status 0 if every check passes.
+
+TEMPLATE = app
+TARGET = SaveGameTest
+CONFIG += console c++17
+CONFIG -= app_bundle
+CONFIG -= qt
+CONFIG += thread
+
+include(../FantasyBoardGame.pri)
+
+SOURCES += \
+        SaveGameTest.cpp